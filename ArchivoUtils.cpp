@@ -1,81 +1,270 @@
 #include "ArchivoUtils.h"
+#include "EscritorParalelo.h"
+#include "Perfilador.h"
+#include "LectorEntrada.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <cstdlib>
+#include <dirent.h>
+#include <sys/stat.h>
+
+// Mensajes informativos desactivados en modo lote (varios hilos escriben a la vez)
+static std::atomic<bool> modoSilencioso(false);
+
+// Filas a partir de las cuales los reportes se formatean en paralelo
+static const size_t UMBRAL_ESCRITURA_PARALELA = 1 << 17;
+
+const char* const ArchivoUtils::TITULO_RESULTADOS = "Resultados de simulación MLFQ";
+
+// Hilos del escritor paralelo (0 = todos; 1 dentro de un pool que ya los ocupa)
+static std::atomic<int> hilosEscritura(0);
+
+namespace {
+
+char* copiarTexto(char* destino, const std::string& texto) {
+    std::memcpy(destino, texto.data(), texto.size());
+    return destino + texto.size();
+}
+
+/**
+ * Filas del archivo de resultados: etiqueta;BT;AT;Q;Pr;WT;CT;RT;TAT
+ */
+class FilasProcesos : public FuenteFilas {
+public:
+    explicit FilasProcesos(const std::vector<Proceso*>& procesos) : procesos(procesos) {}
+
+    size_t numFilas() const override { return procesos.size(); }
+
+    size_t longitudFila(size_t indice) const override {
+        const Proceso* proceso = procesos[indice];
+        return proceso->getEtiqueta().size()
+             + EscritorParalelo::digitos(proceso->getBurstTime())
+             + EscritorParalelo::digitos(proceso->getArrivalTime())
+             + EscritorParalelo::digitos(proceso->getQueueLevel())
+             + EscritorParalelo::digitos(proceso->getPriority())
+             + EscritorParalelo::digitos(proceso->getWaitingTime())
+             + EscritorParalelo::digitos(proceso->getCompletionTime())
+             + EscritorParalelo::digitos(proceso->getResponseTime())
+             + EscritorParalelo::digitos(proceso->getTurnaroundTime())
+             + 9;  // 8 separadores y salto de línea
+    }
+
+    char* formatearFila(size_t indice, char* destino) const override {
+        const Proceso* proceso = procesos[indice];
+        destino = copiarTexto(destino, proceso->getEtiqueta());
+        const int valores[8] = {proceso->getBurstTime(), proceso->getArrivalTime(),
+                                proceso->getQueueLevel(), proceso->getPriority(),
+                                proceso->getWaitingTime(), proceso->getCompletionTime(),
+                                proceso->getResponseTime(), proceso->getTurnaroundTime()};
+        for (int valor : valores) {
+            *destino++ = ';';
+            destino = EscritorParalelo::escribirEntero(destino, valor);
+        }
+        *destino++ = '\n';
+        return destino;
+    }
+
+private:
+    const std::vector<Proceso*>& procesos;
+};
+
+/**
+ * Filas del historial: Proceso;Tiempo_Inicio;Tiempo_Fin;Nivel_Cola;Algoritmo
+ */
+class FilasHistorial : public FuenteFilas {
+public:
+    explicit FilasHistorial(const std::vector<RegistroEjecucion>& historial) : historial(historial) {}
+
+    size_t numFilas() const override { return historial.size(); }
+
+    size_t longitudFila(size_t indice) const override {
+        const RegistroEjecucion& registro = historial[indice];
+        return registro.etiquetaProceso.size()
+             + EscritorParalelo::digitos(registro.tiempoInicio)
+             + EscritorParalelo::digitos(registro.tiempoFin)
+             + EscritorParalelo::digitos(registro.nivelCola)
+             + registro.algoritmo.size()
+             + 5;  // 4 separadores y salto de línea
+    }
+
+    char* formatearFila(size_t indice, char* destino) const override {
+        const RegistroEjecucion& registro = historial[indice];
+        destino = copiarTexto(destino, registro.etiquetaProceso);
+        *destino++ = ';';
+        destino = EscritorParalelo::escribirEntero(destino, registro.tiempoInicio);
+        *destino++ = ';';
+        destino = EscritorParalelo::escribirEntero(destino, registro.tiempoFin);
+        *destino++ = ';';
+        destino = EscritorParalelo::escribirEntero(destino, registro.nivelCola);
+        *destino++ = ';';
+        destino = copiarTexto(destino, registro.algoritmo);
+        *destino++ = '\n';
+        return destino;
+    }
+
+private:
+    const std::vector<RegistroEjecucion>& historial;
+};
+
+} // namespace
 
 /**
  * Lee un archivo de entrada y crea los procesos correspondientes
  */
 std::vector<Proceso*> ArchivoUtils::leerArchivoProcesos(const std::string& nombreArchivo) {
+    MedicionFase medicion(FasePerfil::LECTURA);
     std::vector<Proceso*> procesos;
-    std::ifstream archivo(nombreArchivo);
+    LectorEntrada lector(nombreArchivo);
     
-    if (!archivo.is_open()) {
+    if (!lector.abierto()) {
         std::cerr << "Error: No se pudo abrir el archivo " << nombreArchivo << std::endl;
         return procesos;
     }
     
+    std::istream& archivo = lector.flujo();
     std::string linea;
     int numeroLinea = 0;
     
     while (std::getline(archivo, linea)) {
         numeroLinea++;
         
-        // Saltar líneas vacías y comentarios
-        linea = trim(linea);
-        if (linea.empty() || linea[0] == '#') {
-            continue;
-        }
-        
-        try {
-            // Dividir la línea por punto y coma
-            std::vector<std::string> campos = split(linea, ';');
-            
-            if (campos.size() != 5) {
-                std::cerr << "Advertencia: Línea " << numeroLinea 
-                          << " tiene formato incorrecto (esperados 5 campos): " << linea << std::endl;
-                continue;
-            }
-            
-            // Extraer y limpiar campos
-            std::string etiqueta = trim(campos[0]);
-            int burstTime = std::stoi(trim(campos[1]));
-            int arrivalTime = std::stoi(trim(campos[2]));
-            int queueLevel = std::stoi(trim(campos[3]));
-            int priority = std::stoi(trim(campos[4]));
-            
-            // Validar valores
-            if (burstTime <= 0 || arrivalTime < 0 || queueLevel <= 0 || priority <= 0) {
-                std::cerr << "Advertencia: Línea " << numeroLinea 
-                          << " contiene valores inválidos: " << linea << std::endl;
-                continue;
-            }
-            
-            // Crear proceso
-            Proceso* proceso = new Proceso(etiqueta, burstTime, arrivalTime, queueLevel, priority);
+        Proceso* proceso = interpretarLinea(linea, numeroLinea);
+        if (proceso != nullptr) {
             procesos.push_back(proceso);
-            
-        } catch (const std::exception& e) {
-            std::cerr << "Error procesando línea " << numeroLinea << ": " << e.what() << std::endl;
-            continue;
         }
     }
     
-    archivo.close();
+    // Un archivo comprimido dañado no se simula a medias
+    if (lector.huboError()) {
+        for (Proceso* proceso : procesos) {
+            delete proceso;
+        }
+        procesos.clear();
+        return procesos;
+    }
     
-    std::cout << "Archivo leído exitosamente: " << procesos.size() 
-              << " procesos cargados desde " << nombreArchivo << std::endl;
+    if (!modoSilencioso) {
+        std::cout << "Archivo leído exitosamente: " << procesos.size() 
+                  << " procesos cargados desde " << nombreArchivo << std::endl;
+    }
     
     return procesos;
 }
 
+/**
+ * Interpreta una línea del archivo de entrada
+ */
+Proceso* ArchivoUtils::interpretarLinea(const std::string& lineaOriginal, int numeroLinea) {
+    // Saltar líneas vacías y comentarios
+    std::string linea = trim(lineaOriginal);
+    if (linea.empty() || linea[0] == '#') {
+        return nullptr;
+    }
+    
+    try {
+        // Dividir la línea por punto y coma
+        std::vector<std::string> campos = split(linea, ';');
+        
+        if (campos.size() != 5) {
+            std::cerr << "Advertencia: Línea " << numeroLinea 
+                      << " tiene formato incorrecto (esperados 5 campos): " << linea << std::endl;
+            return nullptr;
+        }
+        
+        // Extraer y limpiar campos
+        std::string etiqueta = trim(campos[0]);
+        int arrivalTime = std::stoi(trim(campos[2]));
+        int queueLevel = std::stoi(trim(campos[3]));
+        int priority = std::stoi(trim(campos[4]));
+        
+        // El burst puede ser una lista CPU,E/S,CPU,... (cantidad impar de ráfagas)
+        std::string campoRafagas = trim(campos[1]);
+        std::vector<int> rafagas;
+        size_t inicio = 0;
+        while (true) {
+            size_t coma = campoRafagas.find(',', inicio);
+            rafagas.push_back(std::stoi(campoRafagas.substr(inicio, coma - inicio)));
+            if (coma == std::string::npos) break;
+            inicio = coma + 1;
+        }
+        if (rafagas.size() % 2 == 0) {
+            std::cerr << "Advertencia: Línea " << numeroLinea
+                      << " debe alternar ráfagas CPU,E/S,...,CPU (cantidad impar): " << linea << std::endl;
+            return nullptr;
+        }
+        
+        // Validar valores
+        bool rafagasValidas = true;
+        for (int rafaga : rafagas) {
+            rafagasValidas = rafagasValidas && rafaga > 0;
+        }
+        if (!rafagasValidas || arrivalTime < 0 || queueLevel <= 0 || priority <= 0) {
+            std::cerr << "Advertencia: Línea " << numeroLinea 
+                      << " contiene valores inválidos: " << linea << std::endl;
+            return nullptr;
+        }
+        
+        // Crear proceso
+        if (rafagas.size() == 1) {
+            return new Proceso(etiqueta, rafagas[0], arrivalTime, queueLevel, priority);
+        }
+        return new Proceso(etiqueta, rafagas, arrivalTime, queueLevel, priority);
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Error procesando línea " << numeroLinea << ": " << e.what() << std::endl;
+        return nullptr;
+    }
+}
+
 /**
  * Escribe los resultados de la simulación a un archivo
  */
 void ArchivoUtils::escribirResultados(const std::string& nombreArchivo, 
                                     const std::vector<Proceso*>& procesos,
                                     const PlanificadorMLFQ& planificador) {
+    escribirTablaResultados(nombreArchivo, procesos,
+                            promediosResultados(planificador.getPromedioWT(), planificador.getPromedioCT(),
+                                                planificador.getPromedioRT(), planificador.getPromedioTAT()) +
+                            sobrecargaResultados(planificador));
+}
+
+/**
+ * Escribe los resultados con los promedios indicados
+ */
+void ArchivoUtils::escribirResultados(const std::string& nombreArchivo,
+                                    const std::vector<Proceso*>& procesos,
+                                    double promedioWT, double promedioCT,
+                                    double promedioRT, double promedioTAT,
+                                    const std::string& titulo) {
+    escribirTablaResultados(nombreArchivo, procesos,
+                            promediosResultados(promedioWT, promedioCT, promedioRT, promedioTAT), titulo);
+}
+
+/**
+ * Escribe la tabla de procesos seguida del pie indicado
+ */
+void ArchivoUtils::escribirTablaResultados(const std::string& nombreArchivo,
+                                         const std::vector<Proceso*>& procesos,
+                                         const std::string& promedios,
+                                         const std::string& titulo) {
+    MedicionFase medicion(FasePerfil::ESCRITURA_RESULTADOS);
+    const std::string encabezado = encabezadoResultados(titulo);
+    
+    // Muchos procesos: formateo por bloques en paralelo con escrituras posicionadas
+    if (procesos.size() >= UMBRAL_ESCRITURA_PARALELA && EscritorParalelo::disponible() &&
+        EscritorParalelo::escribir(nombreArchivo, encabezado, FilasProcesos(procesos), promedios,
+                                   hilosEscritura)) {
+        if (!modoSilencioso) {
+            std::cout << "Resultados escritos en: " << nombreArchivo << std::endl;
+        }
+        return;
+    }
+    
     std::ofstream archivo(nombreArchivo);
     
     if (!archivo.is_open()) {
@@ -84,41 +273,160 @@ void ArchivoUtils::escribirResultados(const std::string& nombreArchivo,
     }
     
     // Escribir encabezado
-    archivo << "# Resultados de simulación MLFQ" << std::endl;
-    archivo << "# Formato: etiqueta;BT;AT;Q;Pr;WT;CT;RT;TAT" << std::endl;
-    archivo << "etiqueta;BT;AT;Q;Pr;WT;CT;RT;TAT" << std::endl;
+    archivo << encabezado;
     
     // Escribir datos de cada proceso
-    for (const Proceso* proceso : procesos) {
-        archivo << proceso->getEtiqueta() << ";"
-                << proceso->getBurstTime() << ";"
-                << proceso->getArrivalTime() << ";"
-                << proceso->getQueueLevel() << ";"
-                << proceso->getPriority() << ";"
-                << proceso->getWaitingTime() << ";"
-                << proceso->getCompletionTime() << ";"
-                << proceso->getResponseTime() << ";"
-                << proceso->getTurnaroundTime() << std::endl;
-    }
+    volcarFilasResultados(archivo, procesos);
     
     // Escribir promedios
-    archivo << std::endl << "# PROMEDIOS" << std::endl;
-    archivo << std::fixed << std::setprecision(2);
-    archivo << "# Waiting Time (WT): " << planificador.getPromedioWT() << std::endl;
-    archivo << "# Completion Time (CT): " << planificador.getPromedioCT() << std::endl;
-    archivo << "# Response Time (RT): " << planificador.getPromedioRT() << std::endl;
-    archivo << "# Turnaround Time (TAT): " << planificador.getPromedioTAT() << std::endl;
+    archivo << promedios;
     
     archivo.close();
     
-    std::cout << "Resultados escritos en: " << nombreArchivo << std::endl;
+    if (!modoSilencioso) {
+        std::cout << "Resultados escritos en: " << nombreArchivo << std::endl;
+    }
 }
 
 /**
- * Escribe un reporte detallado con historial de ejecución
+ * Filas de la tabla de resultados, una por proceso
  */
-void ArchivoUtils::escribirReporteDetallado(const std::string& nombreArchivo,
-                                          const PlanificadorMLFQ& planificador) {
+void ArchivoUtils::volcarFilasResultados(std::ostream& salida, const std::vector<Proceso*>& procesos) {
+    for (const Proceso* proceso : procesos) {
+        salida << proceso->getEtiqueta() << ";"
+               << proceso->getBurstTime() << ";"
+               << proceso->getArrivalTime() << ";"
+               << proceso->getQueueLevel() << ";"
+               << proceso->getPriority() << ";"
+               << proceso->getWaitingTime() << ";"
+               << proceso->getCompletionTime() << ";"
+               << proceso->getResponseTime() << ";"
+               << proceso->getTurnaroundTime() << "\n";
+    }
+}
+
+/**
+ * Filas del historial de ejecución
+ */
+void ArchivoUtils::volcarFilasHistorial(std::ostream& salida, const std::vector<RegistroEjecucion>& historial) {
+    for (const auto& registro : historial) {
+        salida << registro.etiquetaProceso << ";"
+               << registro.tiempoInicio << ";"
+               << registro.tiempoFin << ";"
+               << registro.nivelCola << ";"
+               << registro.algoritmo << "\n";
+    }
+}
+
+/**
+ * Encabezado del archivo de resultados
+ */
+std::string ArchivoUtils::encabezadoResultados(const std::string& titulo) {
+    std::ostringstream encabezado;
+    encabezado << "# " << titulo << std::endl;
+    encabezado << "# Formato: etiqueta;BT;AT;Q;Pr;WT;CT;RT;TAT" << std::endl;
+    encabezado << "etiqueta;BT;AT;Q;Pr;WT;CT;RT;TAT" << std::endl;
+    return encabezado.str();
+}
+
+/**
+ * Bloque de promedios al final del archivo de resultados
+ */
+std::string ArchivoUtils::promediosResultados(double promedioWT, double promedioCT,
+                                              double promedioRT, double promedioTAT) {
+    std::ostringstream promedios;
+    promedios << std::endl << "# PROMEDIOS" << std::endl;
+    promedios << std::fixed << std::setprecision(2);
+    promedios << "# Waiting Time (WT): " << promedioWT << std::endl;
+    promedios << "# Completion Time (CT): " << promedioCT << std::endl;
+    promedios << "# Response Time (RT): " << promedioRT << std::endl;
+    promedios << "# Turnaround Time (TAT): " << promedioTAT << std::endl;
+    return promedios.str();
+}
+
+/**
+ * Tiempo perdido en despachos ("" si el modelo de costos no está activo)
+ */
+std::string ArchivoUtils::sobrecargaResultados(const PlanificadorMLFQ& planificador) {
+    if (!planificador.getModeloCostos().activo()) {
+        return "";
+    }
+    
+    const EstadisticasSobrecarga& sobrecarga = planificador.getSobrecarga();
+    long long perdido = sobrecarga.tiempoCambios + sobrecarga.tiempoCache;
+    long long total = sobrecarga.tiempoUtil + perdido;
+    
+    std::ostringstream texto;
+    texto << std::endl << "# SOBRECARGA DE DESPACHO" << std::endl;
+    texto << "# Despachos: " << sobrecarga.despachos << std::endl;
+    texto << "# Cambios de contexto: " << sobrecarga.cambiosContexto << std::endl;
+    texto << "# Tiempo en cambios de contexto: " << sobrecarga.tiempoCambios << std::endl;
+    texto << "# Tiempo en recarga de caché: " << sobrecarga.tiempoCache << std::endl;
+    texto << "# Tiempo útil de CPU: " << sobrecarga.tiempoUtil << std::endl;
+    texto << std::fixed << std::setprecision(2);
+    texto << "# CPU perdida en sobrecarga: "
+          << (total > 0 ? 100.0 * static_cast<double>(perdido) / static_cast<double>(total) : 0.0)
+          << "%" << std::endl;
+    if (planificador.getTiempoActual() > 0) {
+        texto << "# Rendimiento (procesos por unidad de tiempo): " << std::setprecision(4)
+              << static_cast<double>(planificador.getProcesos().size()) / planificador.getTiempoActual()
+              << std::endl;
+    }
+    return texto.str();
+}
+
+/**
+ * Encabezado del reporte detallado
+ */
+std::string ArchivoUtils::encabezadoDetalle() {
+    return "# Reporte Detallado de Simulación MLFQ\n"
+           "# Historial de Ejecución\n"
+           "Proceso;Tiempo_Inicio;Tiempo_Fin;Nivel_Cola;Algoritmo\n";
+}
+
+/**
+ * Cambios de quantum del controlador adaptativo ("" si no hubo ninguno)
+ */
+std::string ArchivoUtils::cambiosQuantumDetalle(const PlanificadorMLFQ& planificador) {
+    const std::vector<CambioQuantum>& cambios = planificador.getHistorialQuantum();
+    if (cambios.empty()) {
+        return "";
+    }
+    
+    std::ostringstream seccion;
+    seccion << std::endl << "# Cambios de Quantum" << std::endl;
+    seccion << "Tiempo;Nivel_Cola;Quantum_Anterior;Quantum_Nuevo;RT_Ventana;Tasa_Agotados" << std::endl;
+    seccion << std::fixed << std::setprecision(2);
+    for (const CambioQuantum& cambio : cambios) {
+        seccion << cambio.tiempo << ";"
+                << cambio.nivel << ";"
+                << cambio.quantumAnterior << ";"
+                << cambio.quantumNuevo << ";"
+                << cambio.rtVentana << ";"
+                << cambio.tasaDegradacion << std::endl;
+    }
+    return seccion.str();
+}
+
+/**
+ * Bloque de promedios al final del reporte detallado
+ */
+std::string ArchivoUtils::promediosDetalle(const PlanificadorMLFQ& planificador) {
+    std::ostringstream pie;
+    pie << std::endl << "# Métricas Promedio" << std::endl;
+    pie << std::fixed << std::setprecision(2);
+    pie << "Promedio_WT;" << planificador.getPromedioWT() << std::endl;
+    pie << "Promedio_CT;" << planificador.getPromedioCT() << std::endl;
+    pie << "Promedio_RT;" << planificador.getPromedioRT() << std::endl;
+    pie << "Promedio_TAT;" << planificador.getPromedioTAT() << std::endl;
+    return pie.str();
+}
+
+/**
+ * Escribe el reporte de una simulación multinúcleo
+ */
+void ArchivoUtils::escribirReporteMulticore(const std::string& nombreArchivo,
+                                          const PlanificadorMulticore& planificador) {
     std::ofstream archivo(nombreArchivo);
     
     if (!archivo.is_open()) {
@@ -126,29 +434,175 @@ void ArchivoUtils::escribirReporteDetallado(const std::string& nombreArchivo,
         return;
     }
     
-    archivo << "# Reporte Detallado de Simulación MLFQ" << std::endl;
+    archivo << "# Reporte Multinúcleo de Simulación MLFQ" << std::endl;
     archivo << "# Historial de Ejecución" << std::endl;
-    archivo << "Proceso;Tiempo_Inicio;Tiempo_Fin;Nivel_Cola;Algoritmo" << std::endl;
+    archivo << "Nucleo;Proceso;Tiempo_Inicio;Tiempo_Fin;Nivel_Cola;Algoritmo;Migrado" << std::endl;
     
-    std::vector<RegistroEjecucion> historial = planificador.getHistorialEjecucion();
-    for (const auto& registro : historial) {
-        archivo << registro.etiquetaProceso << ";"
+    for (const auto& entrada : planificador.getHistorialEjecucion()) {
+        const RegistroEjecucion& registro = entrada.registro;
+        archivo << entrada.nucleo << ";"
+                << registro.etiquetaProceso << ";"
                 << registro.tiempoInicio << ";"
                 << registro.tiempoFin << ";"
                 << registro.nivelCola << ";"
-                << registro.algoritmo << std::endl;
+                << registro.algoritmo << ";"
+                << (entrada.migrado ? 1 : 0) << std::endl;
     }
     
-    archivo << std::endl << "# Métricas Promedio" << std::endl;
+    archivo << std::endl << "# Estadísticas por Núcleo" << std::endl;
+    archivo << "Nucleo;Tiempo_Ocupado;Tiempo_Migracion;Despachos;Robos;Utilizacion" << std::endl;
     archivo << std::fixed << std::setprecision(2);
+    const std::vector<EstadisticasNucleo>& estadisticas = planificador.getEstadisticasNucleos();
+    for (size_t i = 0; i < estadisticas.size(); i++) {
+        archivo << i << ";"
+                << estadisticas[i].tiempoOcupado << ";"
+                << estadisticas[i].tiempoMigracion << ";"
+                << estadisticas[i].despachos << ";"
+                << estadisticas[i].robos << ";"
+                << estadisticas[i].utilizacion << std::endl;
+    }
+    
+    archivo << std::endl << "# Métricas Promedio" << std::endl;
     archivo << "Promedio_WT;" << planificador.getPromedioWT() << std::endl;
     archivo << "Promedio_CT;" << planificador.getPromedioCT() << std::endl;
     archivo << "Promedio_RT;" << planificador.getPromedioRT() << std::endl;
     archivo << "Promedio_TAT;" << planificador.getPromedioTAT() << std::endl;
+    archivo << "Makespan;" << planificador.getMakespan() << std::endl;
+    archivo << "Desbalance_Carga;" << planificador.getDesbalanceCarga() << std::endl;
+    
+    archivo.close();
+    
+    std::cout << "Reporte multinúcleo escrito en: " << nombreArchivo << std::endl;
+}
+
+/**
+ * Escribe un reporte detallado con historial de ejecución
+ */
+void ArchivoUtils::escribirReporteDetallado(const std::string& nombreArchivo,
+                                          const PlanificadorMLFQ& planificador) {
+    MedicionFase medicion(FasePerfil::ESCRITURA_DETALLE);
+    const std::string encabezado = encabezadoDetalle();
+    const std::vector<RegistroEjecucion>& historial = planificador.getHistorialEjecucion();
+    
+    // Historial grande: formateo por bloques en paralelo con escrituras posicionadas
+    if (historial.size() >= UMBRAL_ESCRITURA_PARALELA && EscritorParalelo::disponible() &&
+        EscritorParalelo::escribir(nombreArchivo, encabezado, FilasHistorial(historial),
+                                   cambiosQuantumDetalle(planificador) + promediosDetalle(planificador),
+                                   hilosEscritura)) {
+        if (!modoSilencioso) {
+            std::cout << "Reporte detallado escrito en: " << nombreArchivo << std::endl;
+        }
+        return;
+    }
+    
+    std::ofstream archivo(nombreArchivo);
+    
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << nombreArchivo << std::endl;
+        return;
+    }
+    
+    archivo << encabezado;
+    volcarFilasHistorial(archivo, historial);
+    
+    archivo << cambiosQuantumDetalle(planificador);
+    archivo << promediosDetalle(planificador);
     
     archivo.close();
     
-    std::cout << "Reporte detallado escrito en: " << nombreArchivo << std::endl;
+    if (!modoSilencioso) {
+        std::cout << "Reporte detallado escrito en: " << nombreArchivo << std::endl;
+    }
+}
+
+/**
+ * Lee el historial de un reporte detallado o multinúcleo
+ */
+std::vector<RegistroEjecucionNucleo> ArchivoUtils::leerHistorial(const std::string& nombreArchivo,
+                                                                 bool& multinucleo) {
+    std::vector<RegistroEjecucionNucleo> historial;
+    multinucleo = false;
+    std::ifstream archivo(nombreArchivo);
+    
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo " << nombreArchivo << std::endl;
+        return historial;
+    }
+    
+    // El historial va desde la línea de encabezado hasta la primera línea vacía o
+    // comentario; después vienen los promedios y las demás secciones
+    std::string linea;
+    int numeroLinea = 0;
+    bool enHistorial = false;
+    while (std::getline(archivo, linea)) {
+        numeroLinea++;
+        if (!enHistorial) {
+            if (linea.compare(0, 8, "Proceso;") == 0 || linea.compare(0, 7, "Nucleo;") == 0) {
+                enHistorial = true;
+                multinucleo = (linea[0] == 'N');
+            }
+            continue;
+        }
+        if (linea.empty() || linea[0] == '#' || linea == "\r") break;
+        
+        std::vector<std::string> campos = split(linea, ';');
+        size_t primero = multinucleo ? 1 : 0;
+        if (campos.size() < primero + 5) {
+            std::cerr << "Advertencia: Línea " << numeroLinea
+                      << " tiene formato incorrecto: " << linea << std::endl;
+            continue;
+        }
+        
+        RegistroEjecucionNucleo entrada;
+        entrada.nucleo = multinucleo ? std::atoi(campos[0].c_str()) : 0;
+        entrada.migrado = multinucleo && campos.size() > 6 && trim(campos[6]) == "1";
+        entrada.registro.etiquetaProceso = campos[primero];
+        entrada.registro.tiempoInicio = std::atoi(campos[primero + 1].c_str());
+        entrada.registro.tiempoFin = std::atoi(campos[primero + 2].c_str());
+        entrada.registro.nivelCola = std::atoi(campos[primero + 3].c_str());
+        entrada.registro.algoritmo = trim(campos[primero + 4]);
+        historial.push_back(entrada);
+    }
+    
+    if (!enHistorial) {
+        std::cerr << "Error: " << nombreArchivo << " no contiene un historial de ejecución" << std::endl;
+    }
+    return historial;
+}
+
+/**
+ * Guarda una instantánea binaria en disco
+ */
+bool ArchivoUtils::guardarInstantanea(const std::string& nombreArchivo, const std::string& instantanea) {
+    std::ofstream archivo(nombreArchivo, std::ios::binary);
+    
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << nombreArchivo << std::endl;
+        return false;
+    }
+    
+    archivo.write(instantanea.data(), static_cast<std::streamsize>(instantanea.size()));
+    archivo.close();
+    
+    std::cout << "Instantánea escrita en: " << nombreArchivo
+              << " (" << instantanea.size() << " bytes)" << std::endl;
+    return archivo.good();
+}
+
+/**
+ * Carga una instantánea binaria desde disco
+ */
+std::string ArchivoUtils::cargarInstantanea(const std::string& nombreArchivo) {
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo abrir el archivo " << nombreArchivo << std::endl;
+        return "";
+    }
+    
+    std::ostringstream contenido;
+    contenido << archivo.rdbuf();
+    return contenido.str();
 }
 
 /**
@@ -192,8 +646,10 @@ bool ArchivoUtils::validarArchivo(const std::string& nombreArchivo) {
 /**
  * Genera un nombre de archivo de salida basado en el archivo de entrada
  */
-std::string ArchivoUtils::generarNombreSalida(const std::string& archivoEntrada, 
+std::string ArchivoUtils::generarNombreSalida(const std::string& archivoEntradaOriginal, 
                                             const std::string& sufijo) {
+    // Las salidas de datos.txt.gz se llaman como las de datos.txt
+    std::string archivoEntrada = LectorEntrada::quitarExtensionCompresion(archivoEntradaOriginal);
     size_t ultimoPunto = archivoEntrada.find_last_of('.');
     
     if (ultimoPunto != std::string::npos) {
@@ -205,4 +661,107 @@ std::string ArchivoUtils::generarNombreSalida(const std::string& archivoEntrada,
         // Sin extensión
         return archivoEntrada + sufijo + ".txt";
     }
-}
\ No newline at end of file
+}
+
+/**
+ * Lista los archivos de entrada de un directorio o patrón
+ */
+std::vector<std::string> ArchivoUtils::listarArchivos(const std::string& patron) {
+    std::vector<std::string> archivos;
+    std::string directorio;
+    std::string patronNombre;
+    
+    struct stat info;
+    bool esDirectorio = stat(patron.c_str(), &info) == 0 && S_ISDIR(info.st_mode);
+    
+    if (esDirectorio) {
+        directorio = patron;
+        patronNombre = "*.txt";     // También *.txt.gz y *.txt.zst
+    } else {
+        size_t barra = patron.find_last_of("/\\");
+        directorio = (barra == std::string::npos) ? "." : patron.substr(0, barra);
+        patronNombre = (barra == std::string::npos) ? patron : patron.substr(barra + 1);
+    }
+    
+    DIR* dir = opendir(directorio.c_str());
+    if (dir == nullptr) {
+        std::cerr << "Error: No se pudo abrir el directorio " << directorio << std::endl;
+        return archivos;
+    }
+    
+    struct dirent* entrada;
+    while ((entrada = readdir(dir)) != nullptr) {
+        std::string nombre = entrada->d_name;
+        if (nombre == "." || nombre == "..") {
+            continue;
+        }
+        std::string sinCompresion = LectorEntrada::quitarExtensionCompresion(nombre);
+        bool coincide = coincidePatron(nombre, patronNombre) ||
+                        (esDirectorio && sinCompresion != nombre && coincidePatron(sinCompresion, patronNombre));
+        if (!coincide) {
+            continue;
+        }
+        
+        // Las salidas del simulador no son entradas, salvo que se nombren sin comodines
+        if ((esDirectorio || patronNombre.find_first_of("*?") != std::string::npos) &&
+            esSalidaGenerada(nombre)) {
+            continue;
+        }
+        
+        std::string ruta = (directorio.back() == '/' ? directorio : directorio + "/") + nombre;
+        if (stat(ruta.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+            archivos.push_back(ruta);
+        }
+    }
+    closedir(dir);
+    
+    std::sort(archivos.begin(), archivos.end());
+    return archivos;
+}
+
+/**
+ * Nombre de un archivo que escribe el propio simulador
+ */
+bool ArchivoUtils::esSalidaGenerada(const std::string& nombre) {
+    return nombre.find("_Config") != std::string::npos ||
+           nombre.find("_detalle") != std::string::npos ||
+           nombre.find("_personalizado") != std::string::npos ||
+           nombre.find("_SRPT") != std::string::npos ||
+           nombre.find("resumen_") == 0;
+}
+
+/**
+ * Comparación con comodines * (cualquier secuencia) y ? (un carácter)
+ */
+bool ArchivoUtils::coincidePatron(const std::string& nombre, const std::string& patron) {
+    size_t n = 0, p = 0;
+    size_t ultimoAsterisco = std::string::npos, marca = 0;
+    
+    while (n < nombre.size()) {
+        if (p < patron.size() && (patron[p] == '?' || patron[p] == nombre[n])) {
+            n++;
+            p++;
+        } else if (p < patron.size() && patron[p] == '*') {
+            ultimoAsterisco = p++;
+            marca = n;
+        } else if (ultimoAsterisco != std::string::npos) {
+            p = ultimoAsterisco + 1;
+            n = ++marca;
+        } else {
+            return false;
+        }
+    }
+    
+    while (p < patron.size() && patron[p] == '*') {
+        p++;
+    }
+    return p == patron.size();
+}
+
+void ArchivoUtils::setModoSilencioso(bool silencioso) {
+    modoSilencioso = silencioso;
+}
+
+void ArchivoUtils::setHilosEscritura(int hilos) {
+    hilosEscritura = hilos;
+}
@@ -3,22 +3,37 @@
 
 #include <vector>
 #include <string>
+#include <ostream>
 #include "Proceso.h"
 #include "PlanificadorMLFQ.h"
+#include "PlanificadorMulticore.h"
 
 /**
  * Clase utilitaria para manejo de archivos de entrada y salida
  */
 class ArchivoUtils {
 public:
+    // Título del encabezado de los resultados del MLFQ
+    static const char* const TITULO_RESULTADOS;
+    
     /**
      * Lee un archivo de entrada y crea los procesos correspondientes
      * Formato esperado: etiqueta;burstTime;arrivalTime;queueLevel;priority
+     * Los archivos gzip o zstd se descomprimen al vuelo (ver LectorEntrada)
      * @param nombreArchivo: ruta del archivo a leer
      * @return vector de punteros a procesos creados
      */
     static std::vector<Proceso*> leerArchivoProcesos(const std::string& nombreArchivo);
     
+    /**
+     * Interpreta una línea del archivo de entrada (mismas validaciones y avisos
+     * que leerArchivoProcesos)
+     * @param linea: texto de la línea
+     * @param numeroLinea: número de línea para los mensajes
+     * @return proceso creado, o nullptr si es comentario, vacía o inválida
+     */
+    static Proceso* interpretarLinea(const std::string& linea, int numeroLinea);
+    
     /**
      * Escribe los resultados de la simulación a un archivo
      * Formato: etiqueta;BT;AT;Q;Pr;WT;CT;RT;TAT
@@ -30,6 +45,42 @@ public:
                                  const std::vector<Proceso*>& procesos,
                                  const PlanificadorMLFQ& planificador);
     
+    /**
+     * Escribe los resultados con promedios ya calculados (independiente del motor)
+     * @param nombreArchivo: ruta del archivo de salida
+     * @param procesos: vector de procesos con métricas calculadas
+     * @param promedioWT, promedioCT, promedioRT, promedioTAT: promedios a reportar
+     * @param titulo: primera línea del encabezado (otro título si no es del MLFQ)
+     */
+    static void escribirResultados(const std::string& nombreArchivo,
+                                 const std::vector<Proceso*>& procesos,
+                                 double promedioWT, double promedioCT,
+                                 double promedioRT, double promedioTAT,
+                                 const std::string& titulo = TITULO_RESULTADOS);
+    
+    /**
+     * Partes fijas de los archivos de salida, compartidas por todos los escritores
+     * para que las salidas sean idénticas byte a byte
+     */
+    static std::string encabezadoResultados(const std::string& titulo = TITULO_RESULTADOS);
+    static void volcarFilasResultados(std::ostream& salida, const std::vector<Proceso*>& procesos);
+    static void volcarFilasHistorial(std::ostream& salida, const std::vector<RegistroEjecucion>& historial);
+    static std::string promediosResultados(double promedioWT, double promedioCT,
+                                         double promedioRT, double promedioTAT);
+    static std::string sobrecargaResultados(const PlanificadorMLFQ& planificador);
+    static std::string encabezadoDetalle();
+    static std::string cambiosQuantumDetalle(const PlanificadorMLFQ& planificador);
+    static std::string promediosDetalle(const PlanificadorMLFQ& planificador);
+    
+    /**
+     * Escribe el reporte de una simulación multinúcleo: historial con núcleo,
+     * utilización por núcleo y desbalance de carga
+     * @param nombreArchivo: ruta del archivo de reporte
+     * @param planificador: planificador multinúcleo ya ejecutado
+     */
+    static void escribirReporteMulticore(const std::string& nombreArchivo,
+                                       const PlanificadorMulticore& planificador);
+    
     /**
      * Escribe un reporte detallado con historial de ejecución
      * @param nombreArchivo: ruta del archivo de reporte
@@ -38,6 +89,31 @@ public:
     static void escribirReporteDetallado(const std::string& nombreArchivo,
                                        const PlanificadorMLFQ& planificador);
     
+    /**
+     * Lee el historial de un reporte detallado (_detalle.txt) o multinúcleo
+     * (_Nnucleos_detalle.txt); en el primer caso todos los registros son del núcleo 0
+     * @param nombreArchivo: ruta del reporte
+     * @param multinucleo: se pone en true si el reporte tiene columna de núcleo
+     * @return registros en el orden del archivo (vacío si no se pudo leer)
+     */
+    static std::vector<RegistroEjecucionNucleo> leerHistorial(const std::string& nombreArchivo,
+                                                              bool& multinucleo);
+    
+    /**
+     * Guarda una instantánea binaria de la simulación en disco
+     * @param nombreArchivo: ruta del archivo de instantánea
+     * @param instantanea: datos generados por PlanificadorMLFQ::crearInstantanea
+     * @return true si se escribió correctamente
+     */
+    static bool guardarInstantanea(const std::string& nombreArchivo, const std::string& instantanea);
+    
+    /**
+     * Carga una instantánea binaria desde disco
+     * @param nombreArchivo: ruta del archivo de instantánea
+     * @return contenido del archivo (vacío si no se pudo leer)
+     */
+    static std::string cargarInstantanea(const std::string& nombreArchivo);
+    
     /**
      * Función auxiliar para limpiar espacios en blanco de una cadena
      * @param str: cadena a limpiar
@@ -68,6 +144,45 @@ public:
      */
     static std::string generarNombreSalida(const std::string& archivoEntrada, 
                                          const std::string& sufijo = "_resultado");
+    
+    /**
+     * Lista los archivos de entrada que corresponden a un directorio o patrón
+     * Un directorio incluye sus archivos .txt (o .txt.gz, .txt.zst) que no sean
+     * salidas del simulador;
+     * un patrón admite comodines * y ? en el nombre (no en el directorio) y
+     * tampoco incluye salidas del simulador
+     * @param patron: directorio o patrón tipo glob (p. ej. Pruebas/mlq*.txt)
+     * @return rutas ordenadas alfabéticamente
+     */
+    static std::vector<std::string> listarArchivos(const std::string& patron);
+    
+    /**
+     * Indica si un nombre corresponde a un patrón con comodines * y ?
+     */
+    static bool coincidePatron(const std::string& nombre, const std::string& patron);
+    
+    /**
+     * Indica si un nombre es de una salida del simulador (_ConfigX, _detalle...)
+     */
+    static bool esSalidaGenerada(const std::string& nombre);
+    
+    /**
+     * Activa o desactiva los mensajes informativos por consola
+     * (los errores se siguen mostrando); útil al procesar muchos archivos
+     */
+    static void setModoSilencioso(bool silencioso);
+    
+    /**
+     * Hilos con que se formatean los reportes grandes (0 = todos los
+     * disponibles); 1 cuando quien escribe ya es una tarea de un pool
+     */
+    static void setHilosEscritura(int hilos);
+
+private:
+    static void escribirTablaResultados(const std::string& nombreArchivo,
+                                      const std::vector<Proceso*>& procesos,
+                                      const std::string& promedios,
+                                      const std::string& titulo = TITULO_RESULTADOS);
 };
 
 #endif // ARCHIVO_UTILS_H
\ No newline at end of file
@@ -0,0 +1,348 @@
+#include "CacheResultados.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace {
+
+// Un solo recorte a la vez dentro del proceso
+std::mutex mutexRecorte;
+std::atomic<unsigned long> contadorTemporales(0);
+
+uint64_t mezclar(uint64_t valor) {
+    valor ^= valor >> 33;
+    valor *= 0xff51afd7ed558ccdULL;
+    valor ^= valor >> 33;
+    valor *= 0xc4ceb9fe1a85ec53ULL;
+    valor ^= valor >> 33;
+    return valor;
+}
+
+/**
+ * Huella de 128 bits: dos cadenas independientes sobre palabras de 64 bits
+ */
+class Huella {
+private:
+    uint64_t a;
+    uint64_t b;
+
+public:
+    Huella() : a(0xcbf29ce484222325ULL), b(0x9e3779b97f4a7c15ULL) {}
+
+    void agregar(uint64_t valor) {
+        a = (a ^ mezclar(valor)) * 0x100000001b3ULL;
+        uint64_t c = b + mezclar(valor ^ 0x5851f42d4c957f2dULL);
+        b = ((c << 31) | (c >> 33)) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    void agregar(int valor) {
+        agregar(static_cast<uint64_t>(static_cast<int64_t>(valor)));
+    }
+
+    void agregar(double valor) {
+        uint64_t bits;
+        std::memcpy(&bits, &valor, sizeof(bits));
+        agregar(bits);
+    }
+
+    void agregar(const std::string& texto) {
+        agregar(static_cast<uint64_t>(texto.size()));
+        for (size_t i = 0; i < texto.size(); i += 8) {
+            uint64_t palabra = 0;
+            std::memcpy(&palabra, texto.data() + i, std::min<size_t>(8, texto.size() - i));
+            agregar(palabra);
+        }
+    }
+
+    std::string hexadecimal() const {
+        char texto[33];
+        std::snprintf(texto, sizeof(texto), "%016llx%016llx",
+                      static_cast<unsigned long long>(mezclar(a)),
+                      static_cast<unsigned long long>(mezclar(b ^ a)));
+        return texto;
+    }
+};
+
+bool leerArchivoCompleto(const std::string& ruta, std::string& contenido) {
+    std::ifstream archivo(ruta, std::ios::binary);
+    if (!archivo.is_open()) return false;
+    archivo.seekg(0, std::ios::end);
+    std::streamoff tamano = archivo.tellg();
+    if (tamano < 0) return false;
+    contenido.resize(static_cast<size_t>(tamano));
+    archivo.seekg(0, std::ios::beg);
+    return archivo.read(&contenido[0], tamano) || tamano == 0;
+}
+
+bool escribirArchivoCompleto(const std::string& ruta, const char* datos, size_t bytes) {
+    std::ofstream archivo(ruta, std::ios::binary | std::ios::trunc);
+    if (!archivo.is_open()) return false;
+    archivo.write(datos, static_cast<std::streamsize>(bytes));
+    return static_cast<bool>(archivo);
+}
+
+} // namespace
+
+CacheResultados::CacheResultados(const std::string& directorio, unsigned long long bytesMaximos)
+    : directorio(directorio), bytesMaximos(bytesMaximos), bytesOcupados(0), aciertos(0), fallos(0) {
+    if (directorio.empty()) return;
+
+    struct stat info;
+    if (stat(directorio.c_str(), &info) != 0) {
+#ifdef _WIN32
+        _mkdir(directorio.c_str());
+#else
+        mkdir(directorio.c_str(), 0755);
+#endif
+    }
+    recortar();     // Mide la caché; el límite pudo haber bajado desde la última ejecución
+}
+
+bool CacheResultados::activa() const {
+    return !directorio.empty();
+}
+
+std::string CacheResultados::rutaEntrada(const std::string& clave) const {
+    return (directorio.back() == '/' ? directorio : directorio + "/") + clave + ".res";
+}
+
+/**
+ * Huella de todo lo que determina las salidas de la simulación
+ */
+std::string CacheResultados::calcularClave(const std::vector<Proceso*>& procesos,
+                                           const PlanificadorMLFQ& planificador) {
+    Huella huella;
+    huella.agregar(VERSION_MOTOR);
+
+    const std::vector<ConfiguracionCola>& configuracion = planificador.getConfiguracion();
+    huella.agregar(static_cast<uint64_t>(configuracion.size()));
+    for (const ConfiguracionCola& cola : configuracion) {
+        huella.agregar(cola.nivel);
+        huella.agregar(static_cast<int>(cola.algoritmo));
+        huella.agregar(cola.quantum);
+    }
+
+    huella.agregar(planificador.getFusionarHistorial() ? 1 : 0);
+    const ControladorQuantum* controlador = planificador.getControladorQuantum();
+    huella.agregar(controlador != nullptr ? 1 : 0);
+    if (controlador != nullptr) {
+        const ParametrosControlQuantum& parametros = controlador->getParametros();
+        huella.agregar(parametros.rtObjetivo);
+        huella.agregar(parametros.tolerancia);
+        huella.agregar(parametros.tasaDegradacionMaxima);
+        huella.agregar(parametros.ventana);
+        huella.agregar(parametros.quantumMinimo);
+        huella.agregar(parametros.quantumMaximo);
+    }
+    const ModeloCostos& costos = planificador.getModeloCostos();
+    huella.agregar(costos.activo() ? 1 : 0);
+    if (costos.activo()) {
+        huella.agregar(costos.costoCambioContexto);
+        huella.agregar(costos.penalizacionCache);
+        huella.agregar(costos.vidaCache);
+    }
+
+    huella.agregar(static_cast<uint64_t>(procesos.size()));
+    for (const Proceso* proceso : procesos) {
+        huella.agregar(proceso->getEtiqueta());
+        huella.agregar(proceso->getArrivalTime());
+        huella.agregar(proceso->getQueueLevel());
+        huella.agregar(proceso->getPriority());
+        if (proceso->esMultirafaga()) {
+            const std::vector<int>& rafagas = proceso->getRafagas();
+            huella.agregar(static_cast<uint64_t>(rafagas.size()));
+            for (int rafaga : rafagas) {
+                huella.agregar(rafaga);
+            }
+        } else {
+            huella.agregar(static_cast<uint64_t>(1));
+            huella.agregar(proceso->getBurstTime());
+        }
+    }
+    return huella.hexadecimal();
+}
+
+/**
+ * Formato de una entrada:
+ *   MLFQ_CACHE <versión>
+ *   <procesos> <WT> <CT> <RT> <TAT>
+ *   <bytes resultados> <bytes detalle>
+ *   <contenido de resultados><contenido de detalle>
+ */
+bool CacheResultados::restaurar(const std::string& clave, const std::string& archivoResultados,
+                                const std::string& archivoDetalle, ResumenGuardado& resumen) {
+    if (!activa()) return false;
+
+    std::string ruta = rutaEntrada(clave);
+    std::string contenido;
+    if (!leerArchivoCompleto(ruta, contenido)) {
+        fallos++;
+        return false;
+    }
+
+    // La cabecera son las tres primeras líneas
+    size_t inicio = 0;
+    for (int linea = 0; linea < 3 && inicio != std::string::npos; linea++) {
+        inicio = contenido.find('\n', inicio);
+        if (inicio != std::string::npos) inicio++;
+    }
+    if (inicio == std::string::npos) {
+        fallos++;
+        return false;
+    }
+
+    std::istringstream cabecera(contenido.substr(0, inicio));
+    std::string marca;
+    int version = 0;
+    size_t bytesResultados = 0;
+    size_t bytesDetalle = 0;
+    cabecera >> marca >> version
+             >> resumen.procesos >> resumen.promedioWT >> resumen.promedioCT
+             >> resumen.promedioRT >> resumen.promedioTAT
+             >> bytesResultados >> bytesDetalle;
+    if (!cabecera || marca != "MLFQ_CACHE" || version != VERSION_MOTOR ||
+        inicio + bytesResultados + bytesDetalle != contenido.size()) {
+        fallos++;
+        return false;
+    }
+
+    const char* datos = contenido.data() + inicio;
+    if (!escribirArchivoCompleto(archivoResultados, datos, bytesResultados) ||
+        !escribirArchivoCompleto(archivoDetalle, datos + bytesResultados, bytesDetalle)) {
+        fallos++;
+        return false;
+    }
+
+    utime(ruta.c_str(), nullptr);   // Marca de uso reciente para el recorte
+    aciertos++;
+    return true;
+}
+
+void CacheResultados::guardar(const std::string& clave, const std::string& archivoResultados,
+                              const std::string& archivoDetalle, const ResumenGuardado& resumen) {
+    if (!activa()) return;
+
+    std::string resultados;
+    std::string detalle;
+    if (!leerArchivoCompleto(archivoResultados, resultados) || !leerArchivoCompleto(archivoDetalle, detalle)) {
+        return;
+    }
+
+    std::ostringstream cabecera;
+    cabecera << "MLFQ_CACHE " << VERSION_MOTOR << "\n"
+             << std::setprecision(17) << resumen.procesos << " " << resumen.promedioWT << " "
+             << resumen.promedioCT << " " << resumen.promedioRT << " " << resumen.promedioTAT << "\n"
+             << resultados.size() << " " << detalle.size() << "\n";
+
+    // Temporal con nombre único y renombrado: nadie lee una entrada a medio escribir
+    std::string ruta = rutaEntrada(clave);
+    unsigned long long bytesEntrada = cabecera.str().size() + resultados.size() + detalle.size();
+    unsigned long long bytesReemplazados = 0;
+    struct stat anterior;
+    if (stat(ruta.c_str(), &anterior) == 0) {
+        bytesReemplazados = static_cast<unsigned long long>(anterior.st_size);
+    }
+    std::string temporal = ruta + "." +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "." +
+        std::to_string(++contadorTemporales) + ".tmp";
+    {
+        std::ofstream archivo(temporal, std::ios::binary | std::ios::trunc);
+        if (!archivo.is_open()) return;
+        archivo << cabecera.str();
+        archivo.write(resultados.data(), static_cast<std::streamsize>(resultados.size()));
+        archivo.write(detalle.data(), static_cast<std::streamsize>(detalle.size()));
+        if (!archivo) {
+            archivo.close();
+            std::remove(temporal.c_str());
+            return;
+        }
+    }
+    if (std::rename(temporal.c_str(), ruta.c_str()) != 0) {
+        std::remove(ruta.c_str());
+        if (std::rename(temporal.c_str(), ruta.c_str()) != 0) {
+            std::remove(temporal.c_str());
+            return;
+        }
+    }
+
+    unsigned long long ocupados = (bytesOcupados += bytesEntrada);
+    if (bytesReemplazados > 0) {
+        ocupados = (bytesOcupados -= std::min(bytesReemplazados, ocupados));
+    }
+    if (bytesMaximos > 0 && ocupados > bytesMaximos) {
+        recortar();
+    }
+}
+
+/**
+ * Mide las entradas en disco y, si pasan del tamaño máximo, borra las usadas
+ * hace más tiempo hasta bajar al 90 % del límite
+ */
+void CacheResultados::recortar() {
+    if (bytesMaximos == 0) return;
+
+    struct Entrada {
+        std::string ruta;
+        long long uso;
+        unsigned long long bytes;
+    };
+
+    std::lock_guard<std::mutex> lock(mutexRecorte);
+    DIR* dir = opendir(directorio.c_str());
+    if (dir == nullptr) return;
+
+    std::vector<Entrada> entradas;
+    unsigned long long total = 0;
+    struct dirent* elemento;
+    while ((elemento = readdir(dir)) != nullptr) {
+        std::string nombre = elemento->d_name;
+        if (nombre.size() < 4 || nombre.compare(nombre.size() - 4, 4, ".res") != 0) {
+            continue;
+        }
+        Entrada entrada;
+        entrada.ruta = (directorio.back() == '/' ? directorio : directorio + "/") + nombre;
+        struct stat info;
+        if (stat(entrada.ruta.c_str(), &info) != 0) continue;
+        entrada.uso = static_cast<long long>(info.st_mtime);
+        entrada.bytes = static_cast<unsigned long long>(info.st_size);
+        total += entrada.bytes;
+        entradas.push_back(entrada);
+    }
+    closedir(dir);
+
+    if (total > bytesMaximos) {
+        // Margen bajo el límite: las siguientes entradas no vuelven a recorrer el directorio
+        unsigned long long objetivo = bytesMaximos - bytesMaximos / 10;
+        std::sort(entradas.begin(), entradas.end(), [](const Entrada& x, const Entrada& y) {
+            return x.uso < y.uso;
+        });
+        for (const Entrada& entrada : entradas) {
+            if (total <= objetivo) break;
+            if (std::remove(entrada.ruta.c_str()) == 0) {
+                total -= entrada.bytes;
+            }
+        }
+    }
+    bytesOcupados = total;
+}
+
+unsigned long CacheResultados::getAciertos() const {
+    return aciertos;
+}
+
+unsigned long CacheResultados::getFallos() const {
+    return fallos;
+}
@@ -0,0 +1,90 @@
+#ifndef CACHE_RESULTADOS_H
+#define CACHE_RESULTADOS_H
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstddef>
+#include "Proceso.h"
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Métricas de una simulación guardada (para resúmenes sin volver a simular)
+ */
+struct ResumenGuardado {
+    size_t procesos;
+    double promedioWT;
+    double promedioCT;
+    double promedioRT;
+    double promedioTAT;
+
+    ResumenGuardado() : procesos(0), promedioWT(0), promedioCT(0), promedioRT(0), promedioTAT(0) {}
+};
+
+/**
+ * Caché en disco de resultados por contenido
+ *
+ * La clave es una huella de 128 bits de la carga interpretada (etiquetas,
+ * ráfagas, llegadas, niveles y prioridades), del vector de ConfiguracionCola,
+ * de las opciones que cambian la simulación (fusionar, quantum adaptativo,
+ * modelo de costos) y de VERSION_MOTOR. Cada entrada es un archivo
+ * <clave>.res con las métricas y el contenido exacto de _ConfigX.txt y
+ * _ConfigX_detalle.txt; un acierto copia ese contenido sin simular.
+ *
+ * El uso se marca con la fecha de modificación de la entrada; al superar el
+ * tamaño máximo se borran las usadas hace más tiempo hasta bajar al 90 % del
+ * límite. El tamaño se recorre en disco al abrir la caché y después se lleva
+ * en memoria, así guardar no lista el directorio salvo cuando hay que
+ * recortar. Las entradas se escriben en un temporal y se renombran, así
+ * varios hilos o procesos pueden compartir el directorio (cada proceso ve el
+ * tamaño real en su siguiente recorte).
+ */
+class CacheResultados {
+public:
+    // Incrementar al cambiar la semántica de la simulación o el formato de las salidas
+    static const int VERSION_MOTOR = 1;
+
+private:
+    std::string directorio;
+    unsigned long long bytesMaximos;        // 0 = sin límite
+    std::atomic<unsigned long long> bytesOcupados;  // Tamaño de las entradas según este proceso
+    std::atomic<unsigned long> aciertos;
+    std::atomic<unsigned long> fallos;
+
+    std::string rutaEntrada(const std::string& clave) const;
+    void recortar();
+
+public:
+    /**
+     * @param directorio: se crea si no existe; vacío desactiva la caché
+     */
+    CacheResultados(const std::string& directorio, unsigned long long bytesMaximos);
+    CacheResultados(const CacheResultados&) = delete;
+    CacheResultados& operator=(const CacheResultados&) = delete;
+
+    bool activa() const;
+
+    /**
+     * Clave de una simulación con el planificador ya configurado (colas y
+     * opciones) y los procesos tal como se leyeron
+     */
+    static std::string calcularClave(const std::vector<Proceso*>& procesos, const PlanificadorMLFQ& planificador);
+
+    /**
+     * Escribe las salidas guardadas bajo la clave
+     * @return false si no hay entrada (o está dañada)
+     */
+    bool restaurar(const std::string& clave, const std::string& archivoResultados,
+                   const std::string& archivoDetalle, ResumenGuardado& resumen);
+
+    /**
+     * Guarda las salidas ya escritas de una simulación y recorta la caché
+     */
+    void guardar(const std::string& clave, const std::string& archivoResultados,
+                 const std::string& archivoDetalle, const ResumenGuardado& resumen);
+
+    unsigned long getAciertos() const;
+    unsigned long getFallos() const;
+};
+
+#endif // CACHE_RESULTADOS_H
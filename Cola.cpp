@@ -18,6 +18,15 @@ int Cola::getQuantum() const {
     return quantum;
 }
 
+/**
+ * Cambia el quantum (Round Robin); afecta a las próximas ejecuciones
+ */
+void Cola::setQuantum(int nuevoQuantum) {
+    if (nuevoQuantum > 0) {
+        quantum = nuevoQuantum;
+    }
+}
+
 int Cola::getNivel() const {
     return nivel;
 }
@@ -102,12 +111,37 @@ void Cola::devolverProceso(Proceso* proceso) {
 }
 
 /**
- * Ordena los procesos por Shortest Job First (burst time restante)
+ * Agrega procesos respetando el orden en que vienen (el de obtenerTodosProcesos).
+ * A diferencia de agregarProceso no reordena con std::sort, que no es estable y
+ * podría desempatar distinto; en SJF/STCF solo se usa stable_sort, que deja
+ * intacto un orden que ya estaba ordenado.
+ */
+void Cola::cargarEnOrden(const std::vector<Proceso*>& procesos) {
+    for (Proceso* proceso : procesos) {
+        if (proceso == nullptr) continue;
+        proceso->setCurrentQueueLevel(nivel);
+        if (algoritmo == TipoAlgoritmo::ROUND_ROBIN) {
+            colaProcesos.push(proceso);
+        } else {
+            vectorProcesos.push_back(proceso);
+        }
+    }
+    
+    if (algoritmo != TipoAlgoritmo::ROUND_ROBIN) {
+        std::stable_sort(vectorProcesos.begin(), vectorProcesos.end(),
+                         [](const Proceso* a, const Proceso* b) {
+                             return a->getRafagaCPURestante() < b->getRafagaCPURestante();
+                         });
+    }
+}
+
+/**
+ * Ordena los procesos por Shortest Job First (ráfaga de CPU restante)
  */
 void Cola::ordenarPorSJF() {
     std::sort(vectorProcesos.begin(), vectorProcesos.end(),
               [](const Proceso* a, const Proceso* b) {
-                  return a->getBurstTimeRestante() < b->getBurstTimeRestante();
+                  return a->getRafagaCPURestante() < b->getRafagaCPURestante();
               });
 }
 
@@ -118,7 +152,7 @@ void Cola::ordenarPorSJF() {
 void Cola::ordenarPorSTCF() {
     std::sort(vectorProcesos.begin(), vectorProcesos.end(),
               [](const Proceso* a, const Proceso* b) {
-                  return a->getBurstTimeRestante() < b->getBurstTimeRestante();
+                  return a->getRafagaCPURestante() < b->getRafagaCPURestante();
               });
 }
 
@@ -183,7 +217,7 @@ void Cola::mostrarEstado() const {
     
     std::vector<Proceso*> procesos = obtenerTodosProcesos();
     for (const auto& proceso : procesos) {
-        std::cout << proceso->getEtiqueta() << "(" << proceso->getBurstTimeRestante() << ") ";
+        std::cout << proceso->getEtiqueta() << "(" << proceso->getRafagaCPURestante() << ") ";
     }
     std::cout << std::endl;
 }
\ No newline at end of file
@@ -37,10 +37,14 @@ public:
     bool isEmpty() const;
     size_t size() const;
     
+    // Setters
+    void setQuantum(int nuevoQuantum);
+    
     // Métodos principales
     void agregarProceso(Proceso* proceso);
     Proceso* obtenerSiguienteProceso();
     void devolverProceso(Proceso* proceso);  // Para Round Robin cuando no termina en quantum
+    void cargarEnOrden(const std::vector<Proceso*>& procesos);  // Restaura el orden guardado
     void ordenarPorSJF();                    // Ordena por burst time restante
     void ordenarPorSTCF();                   // Ordena por tiempo restante
     
@@ -0,0 +1,197 @@
+#ifndef COLA_SPSC_H
+#define COLA_SPSC_H
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <cstddef>
+
+/**
+ * Punto de espera de una o varias ColaSPSC
+ *
+ * Quien espera se anota y duerme en la variable de condición; quien cambia
+ * una cola solo toma el mutex para avisar si hay alguien anotado, así que la
+ * ruta sin espera sigue sin bloqueos. Un consumidor que atiende varias colas
+ * puede darles el mismo aviso y dormir hasta que cualquiera cambie.
+ */
+class AvisoCola {
+private:
+    std::mutex mutex;
+    std::condition_variable condicion;
+    std::atomic<int> esperando;
+
+public:
+    AvisoCola() : esperando(0) {}
+
+    AvisoCola(const AvisoCola&) = delete;
+    AvisoCola& operator=(const AvisoCola&) = delete;
+
+    /**
+     * Duerme hasta que listo() sea verdadero (se evalúa con el mutex tomado)
+     */
+    template <typename Condicion>
+    void esperar(Condicion listo) {
+        std::unique_lock<std::mutex> bloqueo(mutex);
+        esperando.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        condicion.wait(bloqueo, listo);
+        esperando.fetch_sub(1);
+    }
+
+    /**
+     * Despierta a los que esperan, si hay alguno (después de cambiar una cola)
+     */
+    void avisar() {
+        // Ordena el cambio de la cola antes de leer esperando (el que espera
+        // se anota antes de revisar la cola): uno de los dos ve al otro
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (esperando.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> bloqueo(mutex);
+            condicion.notify_all();
+        }
+    }
+};
+
+/**
+ * Cola acotada sin bloqueos para un productor y un consumidor
+ *
+ * Anillo de capacidad potencia de 2 con índices de lectura y escritura
+ * atómicos en líneas de caché distintas. Las operaciones bloqueantes duermen
+ * en un AvisoCola mientras la cola esté llena o vacía; el productor cierra la
+ * cola al terminar y el consumidor sigue leyendo hasta vaciarla. El
+ * consumidor puede cancelarla si deja de leer: el productor deja de esperar.
+ */
+template <typename T>
+class ColaSPSC {
+private:
+    std::vector<T> elementos;
+    size_t mascara;
+
+    alignas(64) std::atomic<size_t> lectura;     // Solo la avanza el consumidor
+    alignas(64) std::atomic<size_t> escritura;   // Solo la avanza el productor
+    alignas(64) std::atomic<bool> cerrada;
+    std::atomic<bool> cancelada;
+
+    AvisoCola avisoPropio;
+    AvisoCola* aviso;
+
+    bool llena() const {
+        return escritura.load(std::memory_order_relaxed) - lectura.load(std::memory_order_acquire) ==
+               elementos.size();
+    }
+
+    static size_t redondearPotencia(size_t capacidad) {
+        size_t potencia = 2;
+        while (potencia < capacidad) {
+            potencia <<= 1;
+        }
+        return potencia;
+    }
+
+public:
+    /**
+     * @param avisoCompartido: aviso común con otras colas (nullptr = uno propio)
+     */
+    explicit ColaSPSC(size_t capacidad = 4096, AvisoCola* avisoCompartido = nullptr)
+        : elementos(redondearPotencia(capacidad)), mascara(elementos.size() - 1),
+          lectura(0), escritura(0), cerrada(false), cancelada(false),
+          aviso(avisoCompartido != nullptr ? avisoCompartido : &avisoPropio) {}
+
+    ColaSPSC(const ColaSPSC&) = delete;
+    ColaSPSC& operator=(const ColaSPSC&) = delete;
+
+    /**
+     * Intenta insertar sin esperar
+     * @return false si la cola está llena
+     */
+    bool intentarEncolar(T& valor) {
+        size_t posicion = escritura.load(std::memory_order_relaxed);
+        if (posicion - lectura.load(std::memory_order_acquire) == elementos.size()) {
+            return false;
+        }
+        elementos[posicion & mascara] = std::move(valor);
+        escritura.store(posicion + 1, std::memory_order_release);
+        aviso->avisar();
+        return true;
+    }
+
+    /**
+     * Intenta extraer sin esperar
+     * @return false si la cola está vacía
+     */
+    bool intentarDesencolar(T& valor) {
+        size_t posicion = lectura.load(std::memory_order_relaxed);
+        if (posicion == escritura.load(std::memory_order_acquire)) {
+            return false;
+        }
+        valor = std::move(elementos[posicion & mascara]);
+        lectura.store(posicion + 1, std::memory_order_release);
+        aviso->avisar();
+        return true;
+    }
+
+    /**
+     * Inserta esperando mientras la cola esté llena
+     * @return false si el consumidor canceló la cola (el valor se descarta)
+     */
+    bool encolar(T valor) {
+        while (!intentarEncolar(valor)) {
+            aviso->esperar([this] { return !llena() || cancelada.load(); });
+            if (cancelada.load()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Extrae esperando mientras la cola esté vacía
+     * @return false si la cola está cerrada y ya no quedan elementos
+     */
+    bool desencolar(T& valor) {
+        while (!intentarDesencolar(valor)) {
+            if (cerrada.load(std::memory_order_acquire)) {
+                // Un último intento: el productor pudo encolar justo antes de cerrar
+                return intentarDesencolar(valor);
+            }
+            aviso->esperar([this] { return !vacia() || cerrada.load(); });
+        }
+        return true;
+    }
+
+    /**
+     * Indica al consumidor que no habrá más elementos (solo el productor)
+     */
+    void cerrar() {
+        cerrada.store(true);
+        aviso->avisar();
+    }
+
+    /**
+     * Indica al productor que nadie leerá más (solo el consumidor)
+     */
+    void cancelar() {
+        cancelada.store(true);
+        aviso->avisar();
+    }
+
+    /**
+     * Sin elementos por leer (desde el consumidor)
+     */
+    bool vacia() const {
+        return lectura.load(std::memory_order_relaxed) == escritura.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Cerrada y vacía: el consumidor ya leyó todo
+     */
+    bool terminada() const {
+        return cerrada.load(std::memory_order_acquire) &&
+               lectura.load(std::memory_order_relaxed) == escritura.load(std::memory_order_acquire);
+    }
+
+    size_t getCapacidad() const { return elementos.size(); }
+};
+
+#endif // COLA_SPSC_H
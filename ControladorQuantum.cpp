@@ -0,0 +1,94 @@
+#include "ControladorQuantum.h"
+#include <algorithm>
+
+ControladorQuantum::ControladorQuantum(const ParametrosControlQuantum& parametros)
+    : parametros(parametros), sumaRespuestas(0) {
+    this->parametros.ventana = std::max(1, parametros.ventana);
+    this->parametros.quantumMinimo = std::max(1, parametros.quantumMinimo);
+    this->parametros.quantumMaximo = std::max(this->parametros.quantumMinimo, parametros.quantumMaximo);
+}
+
+/**
+ * Vacía las ventanas para una nueva simulación
+ */
+void ControladorQuantum::reiniciar(size_t numNiveles) {
+    respuestas.clear();
+    sumaRespuestas = 0;
+    agotados.assign(numNiveles, std::deque<char>());
+    sumaAgotados.assign(numNiveles, 0);
+    respuestasNuevas.assign(numNiveles, 0);
+}
+
+void ControladorQuantum::registrarRespuesta(int tiempoRespuesta) {
+    respuestas.push_back(tiempoRespuesta);
+    sumaRespuestas += tiempoRespuesta;
+    if (static_cast<int>(respuestas.size()) > parametros.ventana) {
+        sumaRespuestas -= respuestas.front();
+        respuestas.pop_front();
+    }
+    for (int& nuevas : respuestasNuevas) {
+        nuevas++;
+    }
+}
+
+void ControladorQuantum::registrarQuantum(int indiceNivel, bool agotado) {
+    if (indiceNivel < 0 || indiceNivel >= static_cast<int>(agotados.size())) return;
+
+    std::deque<char>& ventana = agotados[indiceNivel];
+    ventana.push_back(agotado ? 1 : 0);
+    sumaAgotados[indiceNivel] += agotado ? 1 : 0;
+    if (static_cast<int>(ventana.size()) > parametros.ventana) {
+        sumaAgotados[indiceNivel] -= ventana.front();
+        ventana.pop_front();
+    }
+}
+
+/**
+ * Aplica la regla de ajuste al nivel indicado
+ */
+bool ControladorQuantum::ajustar(int indiceNivel, Cola& cola, int tiempoActual, CambioQuantum& cambio) {
+    if (indiceNivel < 0 || indiceNivel >= static_cast<int>(agotados.size())) return false;
+    if (cola.getAlgoritmo() != TipoAlgoritmo::ROUND_ROBIN) return false;
+
+    std::deque<char>& ventana = agotados[indiceNivel];
+    // Sin una ventana de respuestas posteriores al último cambio el RT medio
+    // todavía no refleja el quantum actual
+    if (static_cast<int>(ventana.size()) < parametros.ventana ||
+        respuestasNuevas[indiceNivel] < parametros.ventana) {
+        return false;
+    }
+
+    double rtVentana = static_cast<double>(sumaRespuestas) / respuestas.size();
+    double tasaDegradacion = static_cast<double>(sumaAgotados[indiceNivel]) / ventana.size();
+    int quantum = cola.getQuantum();
+    int paso = std::max(1, quantum / 4);
+    int nuevoQuantum = quantum;
+
+    if (rtVentana > parametros.rtObjetivo * (1.0 + parametros.tolerancia)) {
+        nuevoQuantum = std::max(parametros.quantumMinimo, quantum - paso);
+    } else if (rtVentana < parametros.rtObjetivo * (1.0 - parametros.tolerancia) &&
+               tasaDegradacion > parametros.tasaDegradacionMaxima) {
+        nuevoQuantum = std::min(parametros.quantumMaximo, quantum + paso);
+    }
+
+    if (nuevoQuantum == quantum) {
+        return false;
+    }
+
+    cola.setQuantum(nuevoQuantum);
+    ventana.clear();
+    sumaAgotados[indiceNivel] = 0;
+    respuestasNuevas[indiceNivel] = 0;
+
+    cambio.tiempo = tiempoActual;
+    cambio.nivel = indiceNivel + 1;
+    cambio.quantumAnterior = quantum;
+    cambio.quantumNuevo = nuevoQuantum;
+    cambio.rtVentana = rtVentana;
+    cambio.tasaDegradacion = tasaDegradacion;
+    return true;
+}
+
+const ParametrosControlQuantum& ControladorQuantum::getParametros() const {
+    return parametros;
+}
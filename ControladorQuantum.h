@@ -0,0 +1,84 @@
+#ifndef CONTROLADOR_QUANTUM_H
+#define CONTROLADOR_QUANTUM_H
+
+#include <vector>
+#include <deque>
+#include "Cola.h"
+
+/**
+ * Parámetros del ajuste automático de quantums
+ */
+struct ParametrosControlQuantum {
+    double rtObjetivo;              // Tiempo de respuesta medio buscado
+    double tolerancia;              // Banda sin cambios alrededor del objetivo (fracción)
+    double tasaDegradacionMaxima;   // Fracción de quantums agotados a partir de la cual se alarga
+    int ventana;                    // Eventos recientes considerados por estadística
+    int quantumMinimo;
+    int quantumMaximo;
+
+    ParametrosControlQuantum()
+        : rtObjetivo(10.0), tolerancia(0.1), tasaDegradacionMaxima(0.5), ventana(32),
+          quantumMinimo(1), quantumMaximo(50) {}
+};
+
+/**
+ * Cambio de quantum aplicado por el controlador (para auditar la política)
+ */
+struct CambioQuantum {
+    int tiempo;                     // Tiempo de simulación del cambio
+    int nivel;                      // Nivel de la cola (1 = mayor prioridad)
+    int quantumAnterior;
+    int quantumNuevo;
+    double rtVentana;               // RT medio de la ventana que motivó el cambio
+    double tasaDegradacion;         // Fracción de quantums agotados en la ventana del nivel
+};
+
+/**
+ * Controlador en línea de los quantums de las colas Round Robin
+ *
+ * Mantiene una ventana deslizante con los tiempos de respuesta de los últimos
+ * procesos despachados por primera vez y, por nivel, otra con los últimos
+ * quantums: 1 si el proceso lo agotó sin terminar, 0 si terminó dentro de él.
+ * Cuando la ventana de un nivel se llena se evalúa la regla:
+ *  - RT medio sobre el objetivo: se acorta el quantum (los procesos nuevos
+ *    esperan menos detrás del que ejecuta)
+ *  - RT medio bajo el objetivo y muchos quantums agotados: se alarga (menos
+ *    degradaciones y cambios de contexto)
+ * Los pasos son de una cuarta parte del quantum (al menos 1) y se respetan los
+ * límites. Tras un cambio la ventana del nivel se vacía y el nivel no vuelve a
+ * cambiar hasta que lleguen otros `ventana` tiempos de respuesta, así la
+ * siguiente decisión se toma con datos del quantum nuevo. Como el RT solo se
+ * mide en el primer despacho, cuando dejan de llegar procesos la ventana de
+ * respuestas queda fija y el controlador deja de tocar los quantums en lugar
+ * de seguir reaccionando al mismo RT.
+ */
+class ControladorQuantum {
+private:
+    ParametrosControlQuantum parametros;
+    std::deque<int> respuestas;
+    long long sumaRespuestas;
+    std::vector<std::deque<char>> agotados;     // Por nivel
+    std::vector<int> sumaAgotados;
+    std::vector<int> respuestasNuevas;          // Por nivel: respuestas desde su último cambio
+
+public:
+    explicit ControladorQuantum(const ParametrosControlQuantum& parametros);
+
+    void reiniciar(size_t numNiveles);
+    void registrarRespuesta(int tiempoRespuesta);
+    void registrarQuantum(int indiceNivel, bool agotado);
+
+    /**
+     * Evalúa la regla para un nivel y, si corresponde, cambia su quantum
+     * @param indiceNivel: nivel 0-based
+     * @param cola: cola Round Robin de ese nivel
+     * @param tiempoActual: tiempo de simulación (para el registro)
+     * @param cambio: datos del cambio aplicado
+     * @return true si el quantum cambió
+     */
+    bool ajustar(int indiceNivel, Cola& cola, int tiempoActual, CambioQuantum& cambio);
+
+    const ParametrosControlQuantum& getParametros() const;
+};
+
+#endif // CONTROLADOR_QUANTUM_H
@@ -0,0 +1,173 @@
+#include "EscritorParalelo.h"
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <iostream>
+#include <cstring>
+#include <cerrno>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const size_t FILAS_POR_BLOQUE = 1 << 16;
+
+#ifndef _WIN32
+/**
+ * pwrite completo: reintenta escrituras parciales e interrumpidas
+ */
+bool escribirEn(int descriptor, const char* datos, size_t longitud, off_t desplazamiento) {
+    while (longitud > 0) {
+        ssize_t escritos = pwrite(descriptor, datos, longitud, desplazamiento);
+        if (escritos < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        datos += escritos;
+        longitud -= static_cast<size_t>(escritos);
+        desplazamiento += escritos;
+    }
+    return true;
+}
+#endif
+
+/**
+ * Ejecuta trabajo(bloque) para todos los bloques repartidos entre los hilos
+ */
+template <typename Trabajo>
+void repartirBloques(size_t numBloques, int hilos, Trabajo trabajo) {
+    std::atomic<size_t> siguiente(0);
+    auto bucle = [&]() {
+        size_t bloque;
+        while ((bloque = siguiente++) < numBloques) {
+            trabajo(bloque);
+        }
+    };
+
+    std::vector<std::thread> trabajadores;
+    for (int i = 1; i < hilos; i++) {
+        trabajadores.push_back(std::thread(bucle));
+    }
+    bucle();
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+}
+
+} // namespace
+
+bool EscritorParalelo::disponible() {
+#ifndef _WIN32
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t EscritorParalelo::digitos(long long valor) {
+    size_t cantidad = valor < 0 ? 2 : 1;
+    unsigned long long magnitud = valor < 0 ? 0ULL - static_cast<unsigned long long>(valor)
+                                            : static_cast<unsigned long long>(valor);
+    while (magnitud >= 10) {
+        magnitud /= 10;
+        cantidad++;
+    }
+    return cantidad;
+}
+
+char* EscritorParalelo::escribirEntero(char* destino, long long valor) {
+    unsigned long long magnitud = static_cast<unsigned long long>(valor);
+    if (valor < 0) {
+        *destino++ = '-';
+        magnitud = 0ULL - magnitud;
+    }
+
+    char temporal[20];
+    int n = 0;
+    do {
+        temporal[n++] = static_cast<char>('0' + magnitud % 10);
+        magnitud /= 10;
+    } while (magnitud > 0);
+
+    while (n > 0) {
+        *destino++ = temporal[--n];
+    }
+    return destino;
+}
+
+/**
+ * Escribe cabecera, filas y pie con bloques formateados en paralelo
+ */
+bool EscritorParalelo::escribir(const std::string& nombreArchivo, const std::string& cabecera,
+                                const FuenteFilas& filas, const std::string& pie, int hilos) {
+#ifdef _WIN32
+    (void)nombreArchivo; (void)cabecera; (void)filas; (void)pie; (void)hilos;
+    return false;
+#else
+    if (hilos <= 0) {
+        unsigned int disponibles = std::thread::hardware_concurrency();
+        hilos = disponibles > 0 ? static_cast<int>(disponibles) : 1;
+    }
+
+    size_t numFilas = filas.numFilas();
+    size_t numBloques = (numFilas + FILAS_POR_BLOQUE - 1) / FILAS_POR_BLOQUE;
+    hilos = static_cast<int>(std::max<size_t>(1, std::min<size_t>(hilos, numBloques)));
+
+    // 1. Longitud de cada bloque
+    std::vector<size_t> longitudes(numBloques + 1, 0);
+    repartirBloques(numBloques, hilos, [&](size_t bloque) {
+        size_t inicio = bloque * FILAS_POR_BLOQUE;
+        size_t fin = std::min(numFilas, inicio + FILAS_POR_BLOQUE);
+        size_t total = 0;
+        for (size_t i = inicio; i < fin; i++) {
+            total += filas.longitudFila(i);
+        }
+        longitudes[bloque + 1] = total;
+    });
+
+    // 2. Suma prefija: desplazamiento de cada bloque después de la cabecera
+    std::vector<off_t> desplazamientos(numBloques + 1);
+    desplazamientos[0] = static_cast<off_t>(cabecera.size());
+    for (size_t bloque = 0; bloque < numBloques; bloque++) {
+        desplazamientos[bloque + 1] = desplazamientos[bloque] + static_cast<off_t>(longitudes[bloque + 1]);
+    }
+    off_t tamanoTotal = desplazamientos[numBloques] + static_cast<off_t>(pie.size());
+
+    // 3. Reservar el archivo con su tamaño final
+    int descriptor = open(nombreArchivo.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descriptor < 0) {
+        return false;
+    }
+    bool correcto = ftruncate(descriptor, tamanoTotal) == 0;
+    correcto = correcto && escribirEn(descriptor, cabecera.data(), cabecera.size(), 0);
+
+    // 4. Formatear y escribir cada bloque en su posición
+    std::atomic<bool> error(false);
+    if (correcto) {
+        repartirBloques(numBloques, hilos, [&](size_t bloque) {
+            if (error) return;
+            size_t inicio = bloque * FILAS_POR_BLOQUE;
+            size_t fin = std::min(numFilas, inicio + FILAS_POR_BLOQUE);
+
+            std::vector<char> buffer(longitudes[bloque + 1]);
+            char* cursor = buffer.data();
+            for (size_t i = inicio; i < fin; i++) {
+                cursor = filas.formatearFila(i, cursor);
+            }
+
+            if (!escribirEn(descriptor, buffer.data(), buffer.size(), desplazamientos[bloque])) {
+                error = true;
+            }
+        });
+    }
+
+    correcto = correcto && !error &&
+               escribirEn(descriptor, pie.data(), pie.size(), desplazamientos[numBloques]);
+    correcto = (close(descriptor) == 0) && correcto;
+    return correcto;
+#endif
+}
@@ -0,0 +1,269 @@
+#include "ExportadorTraza.h"
+#include "EscritorParalelo.h"
+#include "LectorEntrada.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+const size_t BYTES_VOLCADO = 1 << 20;
+const int PISTA_NIVELES = 1000;     // Las pistas de CPU van de 1 a N y las de nivel desde 1001
+
+} // namespace
+
+ExportadorTraza::ExportadorTraza(ObservadorEjecucion* siguiente)
+    : siguiente(siguiente), primerEvento(true), tiempoProfundidades(-1), numNucleos(1), nivelesPorNucleo(0) {}
+
+ExportadorTraza::~ExportadorTraza() {
+    if (archivo.is_open()) {
+        cerrar();
+    }
+}
+
+std::string ExportadorTraza::nombreArchivo(const std::string& archivoEntradaOriginal, const std::string& sufijo) {
+    std::string archivoEntrada = LectorEntrada::quitarExtensionCompresion(archivoEntradaOriginal);
+    size_t ultimoPunto = archivoEntrada.find_last_of('.');
+    std::string base = (ultimoPunto != std::string::npos) ? archivoEntrada.substr(0, ultimoPunto) : archivoEntrada;
+    return base + sufijo + "_traza.json";
+}
+
+bool ExportadorTraza::abrir(const std::string& nombreArchivo, const std::string& titulo,
+                            const std::vector<ConfiguracionCola>& configuracion, int numNucleos) {
+    archivo.open(nombreArchivo, std::ios::binary | std::ios::trunc);
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << nombreArchivo << std::endl;
+        return false;
+    }
+    buffer.clear();
+    buffer.reserve(BYTES_VOLCADO + 4096);
+    primerEvento = true;
+    tiempoProfundidades = -1;
+    this->numNucleos = std::max(1, numNucleos);
+    nivelesPorNucleo = static_cast<int>(configuracion.size());
+    size_t contadores = configuracion.size() * static_cast<size_t>(this->numNucleos);
+    profundidades.assign(contadores, 0);
+    profundidadesEscritas.assign(contadores, -1);
+    profundidadPendiente.assign(contadores, 0);
+    contadoresPendientes.clear();
+
+    buffer += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    abrirEvento();
+    buffer += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":";
+    agregarTexto("MLFQ " + titulo);
+    buffer += "}}";
+    for (int nucleo = 0; nucleo < numNucleos; nucleo++) {
+        metadatosPista(1 + nucleo, "CPU " + std::to_string(nucleo));
+    }
+    for (size_t i = 0; i < configuracion.size(); i++) {
+        metadatosPista(PISTA_NIVELES + 1 + static_cast<int>(i), "Nivel " + std::to_string(i + 1));
+    }
+    return true;
+}
+
+/**
+ * Nombre y orden de una pista (las CPU primero, luego los niveles)
+ */
+void ExportadorTraza::metadatosPista(int pista, const std::string& nombre) {
+    abrirEvento();
+    buffer += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+    agregarEntero(pista);
+    buffer += ",\"args\":{\"name\":";
+    agregarTexto(nombre);
+    buffer += "}}";
+    abrirEvento();
+    buffer += "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+    agregarEntero(pista);
+    buffer += ",\"args\":{\"sort_index\":";
+    agregarEntero(pista);
+    buffer += "}}";
+}
+
+void ExportadorTraza::abrirEvento() {
+    if (!primerEvento) {
+        buffer += ",\n";
+    } else {
+        buffer += "\n";
+        primerEvento = false;
+    }
+}
+
+/**
+ * Cadena JSON entre comillas (las etiquetas vienen del archivo de entrada)
+ */
+void ExportadorTraza::agregarTexto(const std::string& texto) {
+    buffer += '"';
+    for (char caracter : texto) {
+        unsigned char c = static_cast<unsigned char>(caracter);
+        if (c == '"' || c == '\\') {
+            buffer += '\\';
+            buffer += caracter;
+        } else if (c < 0x20) {
+            static const char hex[] = "0123456789abcdef";
+            buffer += "\\u00";
+            buffer += hex[c >> 4];
+            buffer += hex[c & 15];
+        } else {
+            buffer += caracter;
+        }
+    }
+    buffer += '"';
+}
+
+void ExportadorTraza::agregarEntero(long long valor) {
+    char texto[24];
+    char* fin = EscritorParalelo::escribirEntero(texto, valor);
+    buffer.append(texto, static_cast<size_t>(fin - texto));
+}
+
+void ExportadorTraza::volcarSiLleno() {
+    if (buffer.size() >= BYTES_VOLCADO) {
+        archivo.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+}
+
+void ExportadorTraza::intervalo(int nucleo, const RegistroEjecucion& registro) {
+    if (!archivo.is_open()) return;
+
+    // Misma porción en la pista de la CPU y en la del nivel del registro (el
+    // Nivel_Cola del reporte detallado); la categoría es el algoritmo que la ejecutó
+    for (int pista : {1 + nucleo, PISTA_NIVELES + registro.nivelCola}) {
+        abrirEvento();
+        buffer += "{\"name\":";
+        agregarTexto(registro.etiquetaProceso);
+        buffer += ",\"cat\":";
+        agregarTexto(registro.algoritmo);
+        buffer += ",\"ph\":\"X\",\"ts\":";
+        agregarEntero(registro.tiempoInicio);
+        buffer += ",\"dur\":";
+        agregarEntero(static_cast<long long>(registro.tiempoFin) - registro.tiempoInicio);
+        buffer += ",\"pid\":1,\"tid\":";
+        agregarEntero(pista);
+        buffer += ",\"args\":{\"nivel\":";
+        agregarEntero(registro.nivelCola);
+        buffer += "}}";
+    }
+    volcarSiLleno();
+}
+
+void ExportadorTraza::registroCerrado(const RegistroEjecucion& registro) {
+    intervalo(0, registro);
+    if (siguiente != nullptr) {
+        siguiente->registroCerrado(registro);
+    }
+}
+
+void ExportadorTraza::procesoCompletado(const Proceso* proceso) {
+    finProceso(0, proceso);
+    if (siguiente != nullptr) {
+        siguiente->procesoCompletado(proceso);
+    }
+}
+
+void ExportadorTraza::registroCerradoNucleo(int nucleo, const RegistroEjecucion& registro) {
+    intervalo(nucleo, registro);
+    if (siguiente != nullptr) {
+        siguiente->registroCerradoNucleo(nucleo, registro);
+    }
+}
+
+void ExportadorTraza::procesoCompletadoNucleo(int nucleo, const Proceso* proceso) {
+    finProceso(nucleo, proceso);
+    if (siguiente != nullptr) {
+        siguiente->procesoCompletadoNucleo(nucleo, proceso);
+    }
+}
+
+/**
+ * Evento instantáneo en la pista de la CPU donde terminó el proceso
+ */
+void ExportadorTraza::finProceso(int nucleo, const Proceso* proceso) {
+    if (!archivo.is_open()) return;
+
+    abrirEvento();
+    buffer += "{\"name\":";
+    agregarTexto("fin " + proceso->getEtiqueta());
+    buffer += ",\"ph\":\"i\",\"s\":\"t\",\"ts\":";
+    agregarEntero(proceso->getCompletionTime());
+    buffer += ",\"pid\":1,\"tid\":";
+    agregarEntero(1 + nucleo);
+    buffer += "}";
+    volcarSiLleno();
+}
+
+void ExportadorTraza::profundidadCola(int tiempo, int nivel, int procesos) {
+    if (siguiente != nullptr) {
+        siguiente->profundidadCola(tiempo, nivel, procesos);
+    }
+    if (nivel < 1) return;
+    anotarProfundidad(tiempo, static_cast<size_t>(nivel - 1), procesos);
+}
+
+void ExportadorTraza::profundidadColaNucleo(int tiempo, int nucleo, int nivel, int procesos) {
+    if (siguiente != nullptr) {
+        siguiente->profundidadColaNucleo(tiempo, nucleo, nivel, procesos);
+    }
+    if (nivel < 1 || nivel > nivelesPorNucleo || nucleo < 0 || nucleo >= numNucleos) return;
+    anotarProfundidad(tiempo, static_cast<size_t>(nucleo) * nivelesPorNucleo + (nivel - 1), procesos);
+}
+
+void ExportadorTraza::anotarProfundidad(int tiempo, size_t contador, int procesos) {
+    if (!archivo.is_open()) return;
+
+    if (tiempo != tiempoProfundidades) {
+        escribirProfundidades();
+        tiempoProfundidades = tiempo;
+    }
+    if (contador >= profundidades.size()) {
+        profundidades.resize(contador + 1, 0);
+        profundidadesEscritas.resize(contador + 1, -1);
+        profundidadPendiente.resize(contador + 1, 0);
+    }
+    if (!profundidadPendiente[contador]) {
+        profundidadPendiente[contador] = 1;
+        contadoresPendientes.push_back(static_cast<int>(contador));
+    }
+    profundidades[contador] = procesos;
+}
+
+/**
+ * Un contador por cola con el último valor del instante tiempoProfundidades
+ * ("Cola N", o "CPU K cola N" con varios núcleos)
+ */
+void ExportadorTraza::escribirProfundidades() {
+    for (int contador : contadoresPendientes) {
+        profundidadPendiente[contador] = 0;
+        if (profundidades[contador] == profundidadesEscritas[contador]) continue;
+        profundidadesEscritas[contador] = profundidades[contador];
+        abrirEvento();
+        if (numNucleos > 1) {
+            buffer += "{\"name\":\"CPU ";
+            agregarEntero(contador / nivelesPorNucleo);
+            buffer += " cola ";
+            agregarEntero(contador % nivelesPorNucleo + 1);
+        } else {
+            buffer += "{\"name\":\"Cola ";
+            agregarEntero(contador + 1);
+        }
+        buffer += "\",\"ph\":\"C\",\"ts\":";
+        agregarEntero(tiempoProfundidades);
+        buffer += ",\"pid\":1,\"args\":{\"procesos\":";
+        agregarEntero(profundidades[contador]);
+        buffer += "}}";
+    }
+    contadoresPendientes.clear();
+    volcarSiLleno();
+}
+
+bool ExportadorTraza::cerrar() {
+    if (!archivo.is_open()) return false;
+
+    escribirProfundidades();
+    buffer += "\n]}\n";
+    archivo.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+    buffer.shrink_to_fit();
+    bool correcto = static_cast<bool>(archivo);
+    archivo.close();
+    return correcto;
+}
@@ -0,0 +1,89 @@
+#ifndef EXPORTADOR_TRAZA_H
+#define EXPORTADOR_TRAZA_H
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Exporta la planificación en formato Chrome trace (JSON de trace events),
+ * que abren chrome://tracing y ui.perfetto.dev
+ *
+ * Como observador de PlanificadorMLFQ escribe cada registro del historial al
+ * cerrarse, sin esperar al vector completo: con setGuardarHistorial(false) la
+ * memoria no crece con la longitud de la simulación. Cada intervalo aparece en
+ * la pista de su CPU y en la de su nivel; la profundidad de cada cola se
+ * exporta como contador y el fin de cada proceso como evento instantáneo. Una
+ * unidad de tiempo de la simulación es un microsegundo de la traza.
+ *
+ * Con PlanificadorMulticore recibe los eventos con su núcleo (los métodos
+ * *Nucleo): cada intervalo va a la pista de su CPU y hay un contador por cola
+ * de cada núcleo.
+ *
+ * Los eventos se pasan también al observador siguiente, si hay uno (el enlace
+ * del modo en tubería).
+ */
+class ExportadorTraza : public ObservadorEjecucion {
+private:
+    std::ofstream archivo;
+    std::string buffer;                 // Se vuelca al archivo al superar BYTES_VOLCADO
+    ObservadorEjecucion* siguiente;
+    bool primerEvento;
+
+    // Profundidades del último instante, que se escriben al avanzar el reloj
+    // (varios cambios en el mismo instante dejan un solo valor por cola y no se
+    // repite un valor que no cambió). Hay un contador por cola de cada núcleo:
+    // el de la cola `nivel` del núcleo k es k * nivelesPorNucleo + nivel - 1
+    int tiempoProfundidades;
+    int numNucleos;
+    int nivelesPorNucleo;
+    std::vector<int> profundidades;
+    std::vector<int> profundidadesEscritas;     // Valor del último contador escrito (-1 = ninguno)
+    std::vector<char> profundidadPendiente;
+    std::vector<int> contadoresPendientes;
+
+    void abrirEvento();
+    void agregarTexto(const std::string& texto);
+    void agregarEntero(long long valor);
+    void volcarSiLleno();
+    void escribirProfundidades();
+    void anotarProfundidad(int tiempo, size_t contador, int procesos);
+    void metadatosPista(int pista, const std::string& nombre);
+    void intervalo(int nucleo, const RegistroEjecucion& registro);
+    void finProceso(int nucleo, const Proceso* proceso);
+
+public:
+    explicit ExportadorTraza(ObservadorEjecucion* siguiente = nullptr);
+    ~ExportadorTraza();
+    ExportadorTraza(const ExportadorTraza&) = delete;
+    ExportadorTraza& operator=(const ExportadorTraza&) = delete;
+
+    /**
+     * Nombre de la traza junto a las demás salidas: <base><sufijo>_traza.json
+     */
+    static std::string nombreArchivo(const std::string& archivoEntrada, const std::string& sufijo);
+
+    /**
+     * Crea el archivo y escribe los nombres de las pistas
+     * @param titulo: nombre del proceso de la traza (p. ej. "ConfigC")
+     * @return false si no se pudo crear
+     */
+    bool abrir(const std::string& nombreArchivo, const std::string& titulo,
+               const std::vector<ConfiguracionCola>& configuracion, int numNucleos = 1);
+
+    /**
+     * Cierra el JSON; sin llamarlo el archivo queda truncado
+     * @return false si hubo errores de escritura
+     */
+    bool cerrar();
+
+    void registroCerrado(const RegistroEjecucion& registro) override;
+    void procesoCompletado(const Proceso* proceso) override;
+    void profundidadCola(int tiempo, int nivel, int procesos) override;
+    void registroCerradoNucleo(int nucleo, const RegistroEjecucion& registro) override;
+    void procesoCompletadoNucleo(int nucleo, const Proceso* proceso) override;
+    void profundidadColaNucleo(int tiempo, int nucleo, int nivel, int procesos) override;
+};
+
+#endif // EXPORTADOR_TRAZA_H
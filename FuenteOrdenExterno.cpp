@@ -0,0 +1,285 @@
+#include "FuenteOrdenExterno.h"
+#include "OrdenLlegadas.h"
+#include "ArchivoUtils.h"
+#include "LectorEntrada.h"
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace {
+
+/**
+ * Crea un archivo temporal vacío y devuelve su ruta ("" si falla)
+ */
+std::string crearArchivoTemporal(const std::string& directorio) {
+#ifndef _WIN32
+    std::string plantilla = directorio + "/mlfq_tramo_XXXXXX";
+    std::vector<char> ruta(plantilla.begin(), plantilla.end());
+    ruta.push_back('\0');
+    int descriptor = mkstemp(ruta.data());
+    if (descriptor < 0) {
+        return "";
+    }
+    close(descriptor);
+    return std::string(ruta.data());
+#else
+    (void)directorio;
+    char ruta[L_tmpnam];
+    return std::tmpnam(ruta) != nullptr ? std::string(ruta) : std::string("");
+#endif
+}
+
+// Registro de un tramo: llegada, burst, nivel, prioridad, posición en el archivo,
+// etiqueta (longitud + bytes) y ráfagas CPU/E/S (cantidad + valores; 0 si hay una
+// sola ráfaga), en el formato nativo de la máquina
+void escribirRegistro(std::ofstream& salida, const Proceso* proceso, size_t indice) {
+    int32_t campos[4] = {proceso->getArrivalTime(), proceso->getBurstTime(),
+                         proceso->getQueueLevel(), proceso->getPriority()};
+    uint64_t posicion = indice;
+    std::string etiqueta = proceso->getEtiqueta();
+    uint32_t longitud = static_cast<uint32_t>(etiqueta.size());
+
+    salida.write(reinterpret_cast<const char*>(campos), sizeof(campos));
+    salida.write(reinterpret_cast<const char*>(&posicion), sizeof(posicion));
+    salida.write(reinterpret_cast<const char*>(&longitud), sizeof(longitud));
+    salida.write(etiqueta.data(), longitud);
+
+    const std::vector<int>& rafagas = proceso->getRafagas();
+    uint32_t numRafagas = static_cast<uint32_t>(rafagas.size());
+    salida.write(reinterpret_cast<const char*>(&numRafagas), sizeof(numRafagas));
+    for (int rafaga : rafagas) {
+        int32_t valor = rafaga;
+        salida.write(reinterpret_cast<const char*>(&valor), sizeof(valor));
+    }
+}
+
+} // namespace
+
+FuenteOrdenExterno::FuenteOrdenExterno(const std::string& archivo, size_t procesosPorTramo,
+                                       const std::string& directorioTemporal)
+    : archivo(archivo), procesosPorTramo(procesosPorTramo > 0 ? procesosPorTramo : 1),
+      directorioTemporal(directorioTemporal), posicionMemoria(0), totalProcesos(0),
+      ultimoIndice(0), preparada(false) {
+    if (this->directorioTemporal.empty()) {
+        const char* tmpdir = std::getenv("TMPDIR");
+        this->directorioTemporal = (tmpdir != nullptr && *tmpdir != '\0') ? tmpdir : "/tmp";
+    }
+}
+
+FuenteOrdenExterno::~FuenteOrdenExterno() {
+    liberarTramos();
+    for (Proceso* proceso : enMemoria) {
+        delete proceso;
+    }
+}
+
+/**
+ * Cierra los lectores, libera las cabezas pendientes y borra los temporales
+ */
+void FuenteOrdenExterno::liberarTramos() {
+    while (!monticulo.empty()) {
+        delete monticulo.top().proceso;
+        monticulo.pop();
+    }
+    lectores.clear();
+    for (const std::string& ruta : rutasTramos) {
+        std::remove(ruta.c_str());
+    }
+    rutasTramos.clear();
+}
+
+/**
+ * Ordena un tramo y lo escribe en un archivo temporal
+ */
+bool FuenteOrdenExterno::volcarTramo(std::vector<Proceso*>& tramo, std::vector<size_t>& indices) {
+    OrdenLlegadas::ordenarEstable(tramo, &indices);
+
+    std::string ruta = crearArchivoTemporal(directorioTemporal);
+    std::ofstream salida(ruta, std::ios::binary);
+    if (ruta.empty() || !salida.is_open()) {
+        std::cerr << "Error: No se pudo crear un archivo temporal en " << directorioTemporal << std::endl;
+        return false;
+    }
+    rutasTramos.push_back(ruta);
+
+    for (size_t i = 0; i < tramo.size(); i++) {
+        escribirRegistro(salida, tramo[i], indices[i]);
+        delete tramo[i];
+    }
+    tramo.clear();
+    indices.clear();
+
+    salida.close();
+    if (!salida) {
+        std::cerr << "Error: No se pudo escribir el archivo temporal " << ruta << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Lee el archivo por tramos acotados, los ordena y los vuelca a disco
+ */
+bool FuenteOrdenExterno::preparar() {
+    liberarTramos();
+    for (Proceso* proceso : enMemoria) {
+        delete proceso;
+    }
+    enMemoria.clear();
+    indicesMemoria.clear();
+    totalProcesos = 0;
+    preparada = false;
+
+    LectorEntrada lector(archivo);
+    if (!lector.abierto()) {
+        std::cerr << "Error: No se pudo abrir el archivo " << archivo << std::endl;
+        return false;
+    }
+    std::istream& entrada = lector.flujo();
+
+    std::vector<Proceso*> tramo;
+    std::vector<size_t> indices;
+    std::string linea;
+    int numeroLinea = 0;
+
+    while (std::getline(entrada, linea)) {
+        numeroLinea++;
+        Proceso* proceso = ArchivoUtils::interpretarLinea(linea, numeroLinea);
+        if (proceso == nullptr) {
+            continue;
+        }
+
+        tramo.push_back(proceso);
+        indices.push_back(totalProcesos++);
+        if (tramo.size() == procesosPorTramo && !volcarTramo(tramo, indices)) {
+            return false;
+        }
+    }
+    if (lector.huboError()) {
+        for (Proceso* proceso : tramo) {
+            delete proceso;
+        }
+        return false;
+    }
+
+    if (rutasTramos.empty()) {
+        // Todo cupo en un tramo: se mezcla desde memoria
+        OrdenLlegadas::ordenarEstable(tramo, &indices);
+        enMemoria.swap(tramo);
+        indicesMemoria.swap(indices);
+    } else if (!tramo.empty() && !volcarTramo(tramo, indices)) {
+        return false;
+    }
+
+    preparada = true;
+    return reiniciar();
+}
+
+/**
+ * Lee el siguiente registro de un tramo y lo agrega al montículo
+ */
+bool FuenteOrdenExterno::leerRegistro(size_t tramo) {
+    std::ifstream& lector = *lectores[tramo];
+    int32_t campos[4];
+    uint64_t posicion;
+    uint32_t longitud;
+
+    if (!lector.read(reinterpret_cast<char*>(campos), sizeof(campos)) ||
+        !lector.read(reinterpret_cast<char*>(&posicion), sizeof(posicion)) ||
+        !lector.read(reinterpret_cast<char*>(&longitud), sizeof(longitud))) {
+        return false;
+    }
+    std::string etiqueta(longitud, '\0');
+    if (longitud > 0 && !lector.read(&etiqueta[0], longitud)) {
+        return false;
+    }
+    uint32_t numRafagas;
+    if (!lector.read(reinterpret_cast<char*>(&numRafagas), sizeof(numRafagas))) {
+        return false;
+    }
+    std::vector<int> rafagas(numRafagas);
+    for (uint32_t r = 0; r < numRafagas; r++) {
+        int32_t valor;
+        if (!lector.read(reinterpret_cast<char*>(&valor), sizeof(valor))) {
+            return false;
+        }
+        rafagas[r] = valor;
+    }
+
+    Cabeza cabeza;
+    cabeza.llegada = campos[0];
+    cabeza.tramo = tramo;
+    cabeza.indice = static_cast<size_t>(posicion);
+    cabeza.proceso = rafagas.empty()
+        ? new Proceso(etiqueta, campos[1], campos[0], campos[2], campos[3])
+        : new Proceso(etiqueta, rafagas, campos[0], campos[2], campos[3]);
+    monticulo.push(cabeza);
+    return true;
+}
+
+/**
+ * Reabre los tramos para recorrer la entrada desde el principio
+ */
+bool FuenteOrdenExterno::reiniciar() {
+    if (!preparada) return false;
+
+    while (!monticulo.empty()) {
+        delete monticulo.top().proceso;
+        monticulo.pop();
+    }
+    lectores.clear();
+    posicionMemoria = 0;
+
+    for (size_t t = 0; t < rutasTramos.size(); t++) {
+        lectores.push_back(std::unique_ptr<std::ifstream>(
+            new std::ifstream(rutasTramos[t], std::ios::binary)));
+        if (!lectores.back()->is_open()) {
+            std::cerr << "Error: No se pudo abrir el archivo temporal " << rutasTramos[t] << std::endl;
+            return false;
+        }
+        leerRegistro(t);
+    }
+    return true;
+}
+
+/**
+ * Siguiente proceso de la mezcla de k vías (o del único tramo en memoria)
+ */
+Proceso* FuenteOrdenExterno::siguienteLlegada() {
+    if (!preparada) return nullptr;
+
+    if (rutasTramos.empty()) {
+        if (posicionMemoria >= enMemoria.size()) {
+            return nullptr;
+        }
+        ultimoIndice = indicesMemoria[posicionMemoria];
+        return new Proceso(*enMemoria[posicionMemoria++]);
+    }
+
+    if (monticulo.empty()) {
+        return nullptr;
+    }
+    Cabeza cabeza = monticulo.top();
+    monticulo.pop();
+    leerRegistro(cabeza.tramo);
+
+    ultimoIndice = cabeza.indice;
+    return cabeza.proceso;
+}
+
+size_t FuenteOrdenExterno::getTotalProcesos() const {
+    return totalProcesos;
+}
+
+size_t FuenteOrdenExterno::getNumTramos() const {
+    return rutasTramos.empty() ? (enMemoria.empty() ? 0 : 1) : rutasTramos.size();
+}
+
+size_t FuenteOrdenExterno::getUltimoIndice() const {
+    return ultimoIndice;
+}
@@ -0,0 +1,91 @@
+#ifndef FUENTE_ORDEN_EXTERNO_H
+#define FUENTE_ORDEN_EXTERNO_H
+
+#include <vector>
+#include <string>
+#include <queue>
+#include <memory>
+#include <fstream>
+#include <cstddef>
+#include "Proceso.h"
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Fuente de llegadas para archivos mayores que la memoria disponible
+ *
+ * preparar() lee el archivo en tramos de tamaño acotado, ordena cada tramo de
+ * forma estable y lo vuelca a un archivo temporal; siguienteLlegada() mezcla
+ * los tramos con un montículo de k vías. Los empates de llegada se resuelven
+ * por el orden del archivo (tramo anterior primero, y orden dentro del tramo).
+ * Si todo el archivo cabe en un tramo no se escribe nada a disco.
+ *
+ * Cada proceso entregado es nuevo y pasa a ser del llamador.
+ */
+class FuenteOrdenExterno : public FuenteLlegadas {
+private:
+    struct Cabeza {
+        int llegada;
+        size_t tramo;
+        size_t indice;
+        Proceso* proceso;
+    };
+
+    struct ComparadorCabeza {
+        bool operator()(const Cabeza& a, const Cabeza& b) const {
+            if (a.llegada != b.llegada) return a.llegada > b.llegada;
+            return a.tramo > b.tramo;
+        }
+    };
+
+    std::string archivo;
+    size_t procesosPorTramo;
+    std::string directorioTemporal;
+
+    std::vector<std::string> rutasTramos;                   // Tramos volcados a disco
+    std::vector<std::unique_ptr<std::ifstream>> lectores;   // Un lector por tramo durante la mezcla
+    std::priority_queue<Cabeza, std::vector<Cabeza>, ComparadorCabeza> monticulo;
+
+    std::vector<Proceso*> enMemoria;                        // Único tramo, cuando no hubo volcado
+    std::vector<size_t> indicesMemoria;
+    size_t posicionMemoria;
+
+    size_t totalProcesos;
+    size_t ultimoIndice;
+    bool preparada;
+
+    bool volcarTramo(std::vector<Proceso*>& tramo, std::vector<size_t>& indices);
+    bool leerRegistro(size_t tramo);
+    void liberarTramos();
+
+public:
+    /**
+     * @param archivo: archivo de entrada en el formato habitual
+     * @param procesosPorTramo: procesos en memoria por tramo
+     * @param directorioTemporal: dónde crear los tramos (vacío = $TMPDIR o /tmp)
+     */
+    FuenteOrdenExterno(const std::string& archivo, size_t procesosPorTramo = 1 << 20,
+                       const std::string& directorioTemporal = "");
+    ~FuenteOrdenExterno();
+
+    FuenteOrdenExterno(const FuenteOrdenExterno&) = delete;
+    FuenteOrdenExterno& operator=(const FuenteOrdenExterno&) = delete;
+
+    /**
+     * Lee el archivo y genera los tramos ordenados
+     * @return false si no se pudo leer la entrada o escribir un tramo
+     */
+    bool preparar();
+
+    /**
+     * Vuelve al primer proceso (para simular otra configuración con la misma entrada)
+     */
+    bool reiniciar();
+
+    Proceso* siguienteLlegada() override;
+
+    size_t getTotalProcesos() const;
+    size_t getNumTramos() const;
+    size_t getUltimoIndice() const;     // Posición en el archivo del último proceso entregado
+};
+
+#endif // FUENTE_ORDEN_EXTERNO_H
@@ -0,0 +1,134 @@
+#include "IndiceHistorial.h"
+#include <algorithm>
+
+IndiceHistorial::IndiceHistorial()
+    : historial(nullptr), historialNucleos(nullptr) {}
+
+void IndiceHistorial::construir(const std::vector<RegistroEjecucion>& historialEjecucion) {
+    historial = &historialEjecucion;
+    historialNucleos = nullptr;
+    pistasNucleo.assign(1, Pista());
+    pistasProceso.clear();
+    for (size_t i = 0; i < historialEjecucion.size(); i++) {
+        agregarRegistro(i, 0, historialEjecucion[i]);
+    }
+    ordenarPistas();
+}
+
+void IndiceHistorial::construir(const std::vector<RegistroEjecucionNucleo>& historialEjecucion) {
+    historial = nullptr;
+    historialNucleos = &historialEjecucion;
+    pistasNucleo.clear();
+    pistasProceso.clear();
+    for (size_t i = 0; i < historialEjecucion.size(); i++) {
+        agregarRegistro(i, historialEjecucion[i].nucleo, historialEjecucion[i].registro);
+    }
+    ordenarPistas();
+}
+
+void IndiceHistorial::agregarRegistro(size_t posicion, int nucleo, const RegistroEjecucion& registro) {
+    if (nucleo < 0) {
+        nucleo = 0;
+    }
+    if (static_cast<size_t>(nucleo) >= pistasNucleo.size()) {
+        pistasNucleo.resize(static_cast<size_t>(nucleo) + 1);
+    }
+    pistasNucleo[nucleo].posiciones.push_back(posicion);
+    pistasProceso[registro.etiquetaProceso].posiciones.push_back(posicion);
+}
+
+void IndiceHistorial::ordenarPistas() {
+    for (Pista& pista : pistasNucleo) {
+        ordenarPista(pista);
+    }
+    for (auto& entrada : pistasProceso) {
+        ordenarPista(entrada.second);
+    }
+}
+
+/**
+ * Ordena la pista por inicio (el historial de los motores ya suele venir
+ * ordenado y entonces no se reordena) y calcula el máximo prefijo de los fines
+ */
+void IndiceHistorial::ordenarPista(Pista& pista) const {
+    std::vector<size_t>& posiciones = pista.posiciones;
+    bool ordenada = std::is_sorted(posiciones.begin(), posiciones.end(), [this](size_t a, size_t b) {
+        return getRegistro(a).tiempoInicio < getRegistro(b).tiempoInicio;
+    });
+    if (!ordenada) {
+        std::stable_sort(posiciones.begin(), posiciones.end(), [this](size_t a, size_t b) {
+            return getRegistro(a).tiempoInicio < getRegistro(b).tiempoInicio;
+        });
+    }
+
+    pista.inicios.resize(posiciones.size());
+    pista.finMaximo.resize(posiciones.size());
+    int finMaximo = INT_MIN;
+    for (size_t i = 0; i < posiciones.size(); i++) {
+        const RegistroEjecucion& registro = getRegistro(posiciones[i]);
+        finMaximo = std::max(finMaximo, registro.tiempoFin);
+        pista.inicios[i] = registro.tiempoInicio;
+        pista.finMaximo[i] = finMaximo;
+    }
+}
+
+/**
+ * Agrega las posiciones de la pista que se solapan con [desde, hasta)
+ */
+void IndiceHistorial::consultarPista(const Pista& pista, int desde, int hasta,
+                                     std::vector<size_t>& resultado) const {
+    if (desde >= hasta) return;
+
+    // Antes del primer máximo mayor que desde, todos los intervalos terminan a tiempo
+    size_t i = static_cast<size_t>(std::upper_bound(pista.finMaximo.begin(), pista.finMaximo.end(), desde)
+                                   - pista.finMaximo.begin());
+    for (; i < pista.posiciones.size() && pista.inicios[i] < hasta; i++) {
+        // Solo descarta algo si hay intervalos solapados en la misma pista
+        if (getRegistro(pista.posiciones[i]).tiempoFin > desde) {
+            resultado.push_back(pista.posiciones[i]);
+        }
+    }
+}
+
+std::vector<size_t> IndiceHistorial::enInstante(int tiempo) const {
+    return enRango(tiempo, tiempo < INT_MAX ? tiempo + 1 : tiempo);
+}
+
+std::vector<size_t> IndiceHistorial::enRango(int desde, int hasta) const {
+    std::vector<size_t> resultado;
+    for (const Pista& pista : pistasNucleo) {
+        consultarPista(pista, desde, hasta, resultado);
+    }
+    return resultado;
+}
+
+std::vector<size_t> IndiceHistorial::deProceso(const std::string& etiqueta, int desde, int hasta) const {
+    std::vector<size_t> resultado;
+    auto entrada = pistasProceso.find(etiqueta);
+    if (entrada != pistasProceso.end()) {
+        consultarPista(entrada->second, desde, hasta, resultado);
+    }
+    return resultado;
+}
+
+const RegistroEjecucion& IndiceHistorial::getRegistro(size_t posicion) const {
+    return historial != nullptr ? (*historial)[posicion] : (*historialNucleos)[posicion].registro;
+}
+
+int IndiceHistorial::getNucleo(size_t posicion) const {
+    return historial != nullptr ? 0 : (*historialNucleos)[posicion].nucleo;
+}
+
+size_t IndiceHistorial::getNumRegistros() const {
+    if (historial != nullptr) return historial->size();
+    if (historialNucleos != nullptr) return historialNucleos->size();
+    return 0;
+}
+
+size_t IndiceHistorial::getNumProcesos() const {
+    return pistasProceso.size();
+}
+
+int IndiceHistorial::getNumNucleos() const {
+    return static_cast<int>(pistasNucleo.size());
+}
@@ -0,0 +1,81 @@
+#ifndef INDICE_HISTORIAL_H
+#define INDICE_HISTORIAL_H
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <climits>
+#include "PlanificadorMLFQ.h"
+#include "PlanificadorMulticore.h"
+
+/**
+ * Índice por tiempo sobre un historial de ejecución
+ *
+ * Responde qué se ejecutaba en un instante, qué intervalos tocan un rango y
+ * los intervalos de un proceso (opcionalmente acotados a un rango) en
+ * O(log n + k), sin recorrer ni copiar el historial. Por cada núcleo y por
+ * cada proceso guarda las posiciones de sus intervalos ordenadas por inicio y
+ * el máximo prefijo de los fines: la búsqueda binaria sobre ese máximo da el
+ * primer intervalo que puede terminar después del inicio del rango y desde ahí
+ * se avanza hasta el primero que empieza después del fin. Como los intervalos
+ * de un mismo núcleo o proceso no se solapan, cada paso del recorrido es un
+ * resultado.
+ *
+ * Los intervalos son [inicio, fin). Las consultas devuelven posiciones en el
+ * historial indexado, que no debe modificarse mientras se use el índice.
+ */
+class IndiceHistorial {
+private:
+    struct Pista {
+        std::vector<size_t> posiciones;     // Ordenadas por tiempo de inicio
+        std::vector<int> inicios;
+        std::vector<int> finMaximo;         // Máximo de los fines hasta cada posición
+    };
+
+    const std::vector<RegistroEjecucion>* historial;
+    const std::vector<RegistroEjecucionNucleo>* historialNucleos;
+
+    std::vector<Pista> pistasNucleo;
+    std::unordered_map<std::string, Pista> pistasProceso;
+
+    void agregarRegistro(size_t posicion, int nucleo, const RegistroEjecucion& registro);
+    void ordenarPistas();
+    void ordenarPista(Pista& pista) const;
+    void consultarPista(const Pista& pista, int desde, int hasta, std::vector<size_t>& resultado) const;
+
+public:
+    IndiceHistorial();
+
+    /**
+     * Indexa el historial de una CPU (PlanificadorMLFQ::getHistorialEjecucion)
+     */
+    void construir(const std::vector<RegistroEjecucion>& historialEjecucion);
+
+    /**
+     * Indexa el historial multinúcleo, con una pista por núcleo
+     */
+    void construir(const std::vector<RegistroEjecucionNucleo>& historialEjecucion);
+
+    /**
+     * Intervalos en ejecución en el instante indicado (uno por núcleo como máximo)
+     */
+    std::vector<size_t> enInstante(int tiempo) const;
+
+    /**
+     * Intervalos que se solapan con [desde, hasta), por núcleo y en orden de inicio
+     */
+    std::vector<size_t> enRango(int desde, int hasta) const;
+
+    /**
+     * Intervalos del proceso que se solapan con [desde, hasta), en orden de inicio
+     */
+    std::vector<size_t> deProceso(const std::string& etiqueta, int desde = INT_MIN, int hasta = INT_MAX) const;
+
+    const RegistroEjecucion& getRegistro(size_t posicion) const;
+    int getNucleo(size_t posicion) const;
+    size_t getNumRegistros() const;
+    size_t getNumProcesos() const;
+    int getNumNucleos() const;
+};
+
+#endif // INDICE_HISTORIAL_H
@@ -0,0 +1,230 @@
+#include "KernelsMetricas.h"
+#include <algorithm>
+#include <climits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MLFQ_KERNELS_AVX2 1
+#include <immintrin.h>
+#endif
+
+void ArreglosMetricas::redimensionar(size_t n) {
+    burst.resize(n);
+    llegada.resize(n);
+    completado.resize(n);
+    respuesta.resize(n);
+    retorno.resize(n);
+    espera.resize(n);
+}
+
+namespace {
+
+/**
+ * Acumulador escalar de una métrica
+ */
+struct AcumuladorMetrica {
+    long long suma;
+    int32_t minimo;
+    int32_t maximo;
+    long long* histograma;
+    int numCubetas;
+    int anchoCubeta;
+
+    void agregar(int32_t valor) {
+        suma += valor;
+        minimo = std::min(minimo, valor);
+        maximo = std::max(maximo, valor);
+        if (numCubetas > 0) {
+            int cubeta = valor <= 0 ? 0 : valor / anchoCubeta;
+            histograma[std::min(cubeta, numCubetas - 1)]++;
+        }
+    }
+};
+
+void iniciarResumen(ResumenMetrica& resumen, AcumuladorMetrica& acumulador,
+                    int anchoCubeta, int numCubetas) {
+    resumen.histograma.assign(numCubetas, 0);
+    acumulador.suma = 0;
+    acumulador.minimo = INT32_MAX;
+    acumulador.maximo = INT32_MIN;
+    acumulador.histograma = resumen.histograma.data();
+    acumulador.numCubetas = numCubetas;
+    acumulador.anchoCubeta = anchoCubeta;
+}
+
+void cerrarResumen(ResumenMetrica& resumen, const AcumuladorMetrica& acumulador, size_t n) {
+    resumen.suma = acumulador.suma;
+    resumen.minimo = n > 0 ? acumulador.minimo : 0;
+    resumen.maximo = n > 0 ? acumulador.maximo : 0;
+}
+
+// ---------------------------------------------------------------------------
+// Versiones escalares
+// ---------------------------------------------------------------------------
+
+void calcularTiemposEscalar(const int32_t* ct, const int32_t* at, const int32_t* bt,
+                            int32_t* tat, int32_t* wt, size_t inicio, size_t n) {
+    for (size_t i = inicio; i < n; i++) {
+        if (ct[i] > 0) {
+            tat[i] = ct[i] - at[i];
+            wt[i] = tat[i] - bt[i];
+        } else {
+            tat[i] = 0;
+            wt[i] = 0;
+        }
+    }
+}
+
+void estadisticasEscalar(const ArreglosMetricas& m, AcumuladorMetrica* acumuladores,
+                         size_t inicio, size_t n) {
+    for (size_t i = inicio; i < n; i++) {
+        acumuladores[0].agregar(m.espera[i]);
+        acumuladores[1].agregar(m.completado[i]);
+        acumuladores[2].agregar(m.respuesta[i]);
+        acumuladores[3].agregar(m.retorno[i]);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Versiones AVX2 (8 enteros de 32 bits por iteración)
+// ---------------------------------------------------------------------------
+
+#ifdef MLFQ_KERNELS_AVX2
+
+__attribute__((target("avx2")))
+size_t calcularTiemposAVX2(const int32_t* ct, const int32_t* at, const int32_t* bt,
+                           int32_t* tat, int32_t* wt, size_t n) {
+    const __m256i cero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vct = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ct + i));
+        __m256i vat = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(at + i));
+        __m256i vbt = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bt + i));
+
+        __m256i completado = _mm256_cmpgt_epi32(vct, cero);
+        __m256i vtat = _mm256_sub_epi32(vct, vat);
+        __m256i vwt = _mm256_sub_epi32(vtat, vbt);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(tat + i), _mm256_and_si256(vtat, completado));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(wt + i), _mm256_and_si256(vwt, completado));
+    }
+    return i;
+}
+
+/**
+ * Suma (64 bits), mínimo y máximo vectoriales; el histograma se llena en el
+ * mismo recorrido con los valores ya cargados en caché
+ */
+__attribute__((target("avx2")))
+size_t estadisticasAVX2(const ArreglosMetricas& m, AcumuladorMetrica* acumuladores, size_t n) {
+    const int32_t* columnas[4] = {m.espera.data(), m.completado.data(),
+                                  m.respuesta.data(), m.retorno.data()};
+    __m256i sumas[4], minimos[4], maximos[4];
+    for (int c = 0; c < 4; c++) {
+        sumas[c] = _mm256_setzero_si256();
+        minimos[c] = _mm256_set1_epi32(INT32_MAX);
+        maximos[c] = _mm256_set1_epi32(INT32_MIN);
+    }
+
+    bool conHistograma = acumuladores[0].numCubetas > 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        for (int c = 0; c < 4; c++) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columnas[c] + i));
+            minimos[c] = _mm256_min_epi32(minimos[c], v);
+            maximos[c] = _mm256_max_epi32(maximos[c], v);
+            __m256i bajo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v));
+            __m256i alto = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+            sumas[c] = _mm256_add_epi64(sumas[c], _mm256_add_epi64(bajo, alto));
+
+            if (conHistograma) {
+                AcumuladorMetrica& acumulador = acumuladores[c];
+                for (int k = 0; k < 8; k++) {
+                    int32_t valor = columnas[c][i + k];
+                    int cubeta = valor <= 0 ? 0 : valor / acumulador.anchoCubeta;
+                    acumulador.histograma[std::min(cubeta, acumulador.numCubetas - 1)]++;
+                }
+            }
+        }
+    }
+
+    // Reducción horizontal
+    for (int c = 0; c < 4; c++) {
+        alignas(32) long long suma[4];
+        alignas(32) int32_t minimo[8];
+        alignas(32) int32_t maximo[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(suma), sumas[c]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(minimo), minimos[c]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(maximo), maximos[c]);
+
+        acumuladores[c].suma += suma[0] + suma[1] + suma[2] + suma[3];
+        for (int k = 0; k < 8; k++) {
+            acumuladores[c].minimo = std::min(acumuladores[c].minimo, minimo[k]);
+            acumuladores[c].maximo = std::max(acumuladores[c].maximo, maximo[k]);
+        }
+    }
+    return i;
+}
+
+#endif // MLFQ_KERNELS_AVX2
+
+} // namespace
+
+bool KernelsMetricas::usaAVX2() {
+#ifdef MLFQ_KERNELS_AVX2
+    static const bool disponible = __builtin_cpu_supports("avx2");
+    return disponible;
+#else
+    return false;
+#endif
+}
+
+/**
+ * TAT y WT de todos los procesos
+ */
+void KernelsMetricas::calcularTiempos(ArreglosMetricas& metricas) {
+    size_t n = metricas.size();
+    size_t procesados = 0;
+
+#ifdef MLFQ_KERNELS_AVX2
+    if (usaAVX2()) {
+        procesados = calcularTiemposAVX2(metricas.completado.data(), metricas.llegada.data(),
+                                         metricas.burst.data(), metricas.retorno.data(),
+                                         metricas.espera.data(), n);
+    }
+#endif
+
+    // Resto (o todo, sin AVX2)
+    calcularTiemposEscalar(metricas.completado.data(), metricas.llegada.data(), metricas.burst.data(),
+                           metricas.retorno.data(), metricas.espera.data(), procesados, n);
+}
+
+/**
+ * Suma, mínimo, máximo e histograma de WT, CT, RT y TAT en una pasada
+ */
+EstadisticasMetricas KernelsMetricas::calcularEstadisticas(const ArreglosMetricas& metricas,
+                                                           int anchoCubeta, int numCubetas) {
+    EstadisticasMetricas estadisticas;
+    size_t n = metricas.size();
+    estadisticas.n = n;
+    anchoCubeta = std::max(1, anchoCubeta);
+    numCubetas = std::max(0, numCubetas);
+
+    ResumenMetrica* resumenes[4] = {&estadisticas.wt, &estadisticas.ct, &estadisticas.rt, &estadisticas.tat};
+    AcumuladorMetrica acumuladores[4];
+    for (int c = 0; c < 4; c++) {
+        iniciarResumen(*resumenes[c], acumuladores[c], anchoCubeta, numCubetas);
+    }
+
+    size_t procesados = 0;
+#ifdef MLFQ_KERNELS_AVX2
+    if (usaAVX2()) {
+        procesados = estadisticasAVX2(metricas, acumuladores, n);
+    }
+#endif
+    estadisticasEscalar(metricas, acumuladores, procesados, n);
+
+    for (int c = 0; c < 4; c++) {
+        cerrarResumen(*resumenes[c], acumuladores[c], n);
+    }
+    return estadisticas;
+}
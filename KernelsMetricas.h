@@ -0,0 +1,71 @@
+#ifndef KERNELS_METRICAS_H
+#define KERNELS_METRICAS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Métricas de todos los procesos en arreglos contiguos (estructura de arreglos)
+ */
+struct ArreglosMetricas {
+    std::vector<int32_t> burst;         // BT
+    std::vector<int32_t> llegada;       // AT
+    std::vector<int32_t> completado;    // CT
+    std::vector<int32_t> respuesta;     // RT
+    std::vector<int32_t> retorno;       // TAT (salida de calcularTiempos)
+    std::vector<int32_t> espera;        // WT (salida de calcularTiempos)
+
+    void redimensionar(size_t n);
+    size_t size() const { return completado.size(); }
+};
+
+/**
+ * Suma, mínimo, máximo e histograma de una métrica
+ */
+struct ResumenMetrica {
+    long long suma;
+    int32_t minimo;
+    int32_t maximo;
+    std::vector<long long> histograma;  // Cubetas de ancho fijo desde 0; la última acumula el resto
+};
+
+/**
+ * Estadísticas de fin de simulación para WT, CT, RT y TAT
+ */
+struct EstadisticasMetricas {
+    size_t n;
+    ResumenMetrica wt;
+    ResumenMetrica ct;
+    ResumenMetrica rt;
+    ResumenMetrica tat;
+};
+
+/**
+ * Kernels vectorizados para métricas de fin de simulación
+ *
+ * Usan AVX2 cuando el procesador lo soporta (detección en tiempo de ejecución)
+ * y una versión escalar equivalente en otro caso. Las sumas se acumulan en
+ * enteros de 64 bits, por lo que los promedios coinciden exactamente con la
+ * suma en double de valores enteros.
+ */
+class KernelsMetricas {
+public:
+    /**
+     * TAT = CT - AT y WT = TAT - BT para los procesos con CT > 0
+     * (los demás quedan en 0, igual que Proceso::calcularTiempos)
+     */
+    static void calcularTiempos(ArreglosMetricas& metricas);
+
+    /**
+     * Suma, mínimo, máximo e histograma de las cuatro métricas en una pasada
+     * @param anchoCubeta: ancho de cada cubeta del histograma (> 0)
+     * @param numCubetas: cantidad de cubetas (0 = sin histograma)
+     */
+    static EstadisticasMetricas calcularEstadisticas(const ArreglosMetricas& metricas,
+                                                     int anchoCubeta = 1, int numCubetas = 0);
+
+    static bool usaAVX2();
+};
+
+#endif // KERNELS_METRICAS_H
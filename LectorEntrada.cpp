@@ -0,0 +1,316 @@
+#include "LectorEntrada.h"
+#include <iostream>
+
+#ifdef MLFQ_CON_ZLIB
+#include <zlib.h>
+#endif
+#ifdef MLFQ_CON_ZSTD
+#include <zstd.h>
+#endif
+
+namespace {
+
+const size_t BYTES_BLOQUE = 1 << 20;        // Texto descomprimido por bloque entregado
+const size_t BYTES_LECTURA = 256 << 10;     // Datos comprimidos por lectura del archivo
+const size_t BLOQUES_EN_VUELO = 4;          // Bloques listos que el hilo adelanta al intérprete
+
+bool terminaCon(const std::string& texto, const std::string& sufijo) {
+    return texto.size() >= sufijo.size() &&
+           texto.compare(texto.size() - sufijo.size(), sufijo.size(), sufijo) == 0;
+}
+
+const char* nombreFormato(FormatoEntrada formato) {
+    return formato == FormatoEntrada::GZIP ? "gzip" : "zstd";
+}
+
+} // namespace
+
+LectorEntrada::BufferDescompresion::BufferDescompresion()
+    : archivo(nullptr), formato(FormatoEntrada::TEXTO), llenos(BLOQUES_EN_VUELO), libres(BLOQUES_EN_VUELO * 2),
+      error(false) {}
+
+LectorEntrada::BufferDescompresion::~BufferDescompresion() {
+    llenos.cancelar();
+    if (hilo.joinable()) {
+        hilo.join();
+    }
+    if (archivo != nullptr) {
+        std::fclose(archivo);
+    }
+}
+
+void LectorEntrada::BufferDescompresion::iniciar(std::FILE* archivoComprimido, const std::string& nombre,
+                                                 FormatoEntrada formatoArchivo) {
+    archivo = archivoComprimido;
+    nombreArchivo = nombre;
+    formato = formatoArchivo;
+    hilo = std::thread(&BufferDescompresion::descomprimir, this);
+}
+
+bool LectorEntrada::BufferDescompresion::iniciado() const {
+    return archivo != nullptr;
+}
+
+bool LectorEntrada::BufferDescompresion::huboError() const {
+    return error.load();
+}
+
+/**
+ * Pasa un bloque al lector; false si el lector ya no lo quiere
+ */
+bool LectorEntrada::BufferDescompresion::entregar(std::vector<char>& bloque) {
+    return llenos.encolar(std::move(bloque));
+}
+
+/**
+ * Bloque vacío de BYTES_BLOQUE bytes, reutilizado si el lector devolvió alguno
+ */
+std::vector<char> LectorEntrada::BufferDescompresion::bloqueLibre() {
+    std::vector<char> bloque;
+    libres.intentarDesencolar(bloque);
+    bloque.resize(BYTES_BLOQUE);
+    return bloque;
+}
+
+void LectorEntrada::BufferDescompresion::fallar(const char* detalle) {
+    std::cerr << "Error: " << nombreArchivo << " (" << nombreFormato(formato) << "): " << detalle << std::endl;
+    error = true;
+}
+
+/**
+ * Hilo descompresor: llena bloques hasta el final del archivo y cierra la cola
+ */
+void LectorEntrada::BufferDescompresion::descomprimir() {
+    if (formato == FormatoEntrada::GZIP) {
+        descomprimirGzip();
+    } else {
+        descomprimirZstd();
+    }
+    if (std::ferror(archivo)) {
+        fallar("error de lectura");
+    }
+    llenos.cerrar();
+}
+
+/**
+ * gzip con zlib; varios miembros concatenados (cat a.gz b.gz, pigz) forman un
+ * solo texto
+ */
+void LectorEntrada::BufferDescompresion::descomprimirGzip() {
+#ifdef MLFQ_CON_ZLIB
+    z_stream zlib = z_stream();
+    if (inflateInit2(&zlib, 15 + 32) != Z_OK) {    // 15 + 32: ventana máxima, cabecera gzip o zlib
+        fallar("no se pudo iniciar zlib");
+        return;
+    }
+    std::vector<unsigned char> entrada(BYTES_LECTURA);
+    std::vector<char> bloque = bloqueLibre();
+    size_t usados = 0;
+    bool finMiembro = false;
+    bool finArchivo = false;
+    bool salidaLlena = false;   // zlib pudo quedarse con salida aunque no quede entrada
+
+    while (true) {
+        if (zlib.avail_in == 0 && !finArchivo) {
+            size_t leidos = std::fread(entrada.data(), 1, entrada.size(), archivo);
+            finArchivo = leidos < entrada.size();
+            zlib.next_in = entrada.data();
+            zlib.avail_in = static_cast<uInt>(leidos);
+        }
+        if (zlib.avail_in == 0 && (finMiembro || !salidaLlena)) {
+            break;
+        }
+        if (finMiembro) {
+            inflateReset(&zlib);
+            finMiembro = false;
+        }
+
+        zlib.next_out = reinterpret_cast<Bytef*>(bloque.data() + usados);
+        zlib.avail_out = static_cast<uInt>(bloque.size() - usados);
+        int resultado = inflate(&zlib, Z_NO_FLUSH);
+        if (resultado != Z_OK && resultado != Z_STREAM_END && resultado != Z_BUF_ERROR) {
+            fallar(zlib.msg != nullptr ? zlib.msg : "datos dañados");
+            inflateEnd(&zlib);
+            return;
+        }
+        finMiembro = (resultado == Z_STREAM_END);
+        salidaLlena = (zlib.avail_out == 0);
+        usados = bloque.size() - zlib.avail_out;
+
+        if (salidaLlena) {
+            if (!entregar(bloque)) {
+                inflateEnd(&zlib);
+                return;
+            }
+            bloque = bloqueLibre();
+            usados = 0;
+        }
+    }
+    inflateEnd(&zlib);
+
+    if (usados > 0) {
+        bloque.resize(usados);
+        entregar(bloque);
+    }
+    if (!finMiembro) {
+        fallar("archivo truncado");
+    }
+#endif
+}
+
+/**
+ * zstd con libzstd; los frames concatenados también forman un solo texto
+ */
+void LectorEntrada::BufferDescompresion::descomprimirZstd() {
+#ifdef MLFQ_CON_ZSTD
+    ZSTD_DStream* zstd = ZSTD_createDStream();
+    if (zstd == nullptr || ZSTD_isError(ZSTD_initDStream(zstd))) {
+        fallar("no se pudo iniciar zstd");
+        ZSTD_freeDStream(zstd);
+        return;
+    }
+    std::vector<char> entrada(BYTES_LECTURA);
+    std::vector<char> bloque = bloqueLibre();
+    ZSTD_inBuffer datos = {entrada.data(), 0, 0};
+    ZSTD_outBuffer salida = {bloque.data(), bloque.size(), 0};
+    size_t pendiente = 0;       // 0 al terminar un frame
+    bool finArchivo = false;
+
+    while (true) {
+        if (datos.pos == datos.size && !finArchivo) {
+            size_t leidos = std::fread(entrada.data(), 1, entrada.size(), archivo);
+            finArchivo = leidos < entrada.size();
+            datos.size = leidos;
+            datos.pos = 0;
+        }
+        if (datos.pos == datos.size && pendiente == 0) {
+            break;
+        }
+
+        // Sin entrada se sigue llamando mientras el decodificador entregue lo que retuvo
+        size_t antes = salida.pos;
+        pendiente = ZSTD_decompressStream(zstd, &salida, &datos);
+        if (ZSTD_isError(pendiente)) {
+            fallar(ZSTD_getErrorName(pendiente));
+            ZSTD_freeDStream(zstd);
+            return;
+        }
+
+        if (salida.pos == salida.size) {
+            if (!entregar(bloque)) {
+                ZSTD_freeDStream(zstd);
+                return;
+            }
+            bloque = bloqueLibre();
+            salida.dst = bloque.data();
+            salida.size = bloque.size();
+            salida.pos = 0;
+        } else if (datos.pos == datos.size && finArchivo && salida.pos == antes) {
+            break;      // Sin progreso: el archivo termina a mitad de un frame
+        }
+    }
+    ZSTD_freeDStream(zstd);
+
+    if (salida.pos > 0) {
+        bloque.resize(salida.pos);
+        entregar(bloque);
+    }
+    if (pendiente != 0) {
+        fallar("archivo truncado");
+    }
+#endif
+}
+
+LectorEntrada::BufferDescompresion::int_type LectorEntrada::BufferDescompresion::underflow() {
+    if (gptr() < egptr()) {
+        return traits_type::to_int_type(*gptr());
+    }
+    if (!actual.empty()) {
+        libres.intentarEncolar(actual);     // Si la cola está llena el bloque se libera
+    }
+    actual.clear();
+    while (actual.empty()) {
+        if (!llenos.desencolar(actual)) {
+            setg(nullptr, nullptr, nullptr);
+            return traits_type::eof();
+        }
+    }
+    setg(actual.data(), actual.data(), actual.data() + actual.size());
+    return traits_type::to_int_type(*gptr());
+}
+
+LectorEntrada::LectorEntrada(const std::string& nombreArchivo)
+    : formato(detectarFormato(nombreArchivo)), flujoComprimido(nullptr) {
+    if (formato == FormatoEntrada::TEXTO) {
+        archivoTexto.open(nombreArchivo);
+        return;
+    }
+
+    bool soportado = false;
+#ifdef MLFQ_CON_ZLIB
+    soportado = soportado || formato == FormatoEntrada::GZIP;
+#endif
+#ifdef MLFQ_CON_ZSTD
+    soportado = soportado || formato == FormatoEntrada::ZSTD;
+#endif
+    if (!soportado) {
+        std::cerr << "Error: " << nombreArchivo << " está comprimido con " << nombreFormato(formato)
+                  << " y el simulador se compiló sin soporte para ese formato ("
+                  << (formato == FormatoEntrada::GZIP ? "make ZLIB=1" : "make ZSTD=1") << ")" << std::endl;
+        return;
+    }
+
+    std::FILE* archivo = std::fopen(nombreArchivo.c_str(), "rb");
+    if (archivo == nullptr) {
+        return;
+    }
+    descompresion.iniciar(archivo, nombreArchivo, formato);
+    flujoComprimido.rdbuf(&descompresion);
+}
+
+LectorEntrada::~LectorEntrada() {
+    flujoComprimido.rdbuf(nullptr);
+}
+
+bool LectorEntrada::abierto() const {
+    return formato == FormatoEntrada::TEXTO ? archivoTexto.is_open() : descompresion.iniciado();
+}
+
+std::istream& LectorEntrada::flujo() {
+    if (formato == FormatoEntrada::TEXTO) {
+        return archivoTexto;
+    }
+    return flujoComprimido;
+}
+
+bool LectorEntrada::huboError() const {
+    return descompresion.huboError();
+}
+
+FormatoEntrada LectorEntrada::getFormato() const {
+    return formato;
+}
+
+FormatoEntrada LectorEntrada::detectarFormato(const std::string& nombreArchivo) {
+    unsigned char magico[4] = {0, 0, 0, 0};
+    std::ifstream archivo(nombreArchivo, std::ios::binary);
+    archivo.read(reinterpret_cast<char*>(magico), sizeof(magico));
+
+    if (archivo.gcount() >= 2 && magico[0] == 0x1f && magico[1] == 0x8b) {
+        return FormatoEntrada::GZIP;
+    }
+    if (archivo.gcount() == 4 && magico[0] == 0x28 && magico[1] == 0xb5 && magico[2] == 0x2f && magico[3] == 0xfd) {
+        return FormatoEntrada::ZSTD;
+    }
+    return FormatoEntrada::TEXTO;
+}
+
+std::string LectorEntrada::quitarExtensionCompresion(const std::string& nombreArchivo) {
+    if (terminaCon(nombreArchivo, ".gz")) {
+        return nombreArchivo.substr(0, nombreArchivo.size() - 3);
+    }
+    if (terminaCon(nombreArchivo, ".zst")) {
+        return nombreArchivo.substr(0, nombreArchivo.size() - 4);
+    }
+    return nombreArchivo;
+}
@@ -0,0 +1,121 @@
+#ifndef LECTOR_ENTRADA_H
+#define LECTOR_ENTRADA_H
+
+#include <string>
+#include <istream>
+#include <fstream>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <cstdio>
+#include "ColaSPSC.h"
+
+/**
+ * Formato de un archivo de entrada, según sus primeros bytes
+ */
+enum class FormatoEntrada {
+    TEXTO,
+    GZIP,
+    ZSTD
+};
+
+/**
+ * Flujo de lectura de un archivo de entrada, comprimido o no
+ *
+ * Los archivos gzip (.gz) y zstd (.zst) se reconocen por su número mágico y se
+ * descomprimen en un hilo aparte, que entrega bloques de texto al flujo por
+ * una ColaSPSC mientras el intérprete consume los anteriores: no se escribe
+ * nada en disco y la lectura avanza casi a la velocidad del descompresor. Los
+ * archivos de texto se leen con un std::ifstream como siempre.
+ *
+ * El soporte de gzip necesita compilar con zlib (MLFQ_CON_ZLIB, activo por
+ * defecto en el Makefile) y el de zstd con libzstd (MLFQ_CON_ZSTD, make ZSTD=1).
+ */
+class LectorEntrada {
+private:
+    /**
+     * streambuf que lee los bloques que produce el hilo descompresor
+     *
+     * Los bloques ya leídos vuelven al hilo por una segunda cola para
+     * reutilizar su memoria. Si se destruye antes del final (el lector dejó de
+     * leer), el hilo se detiene en la siguiente entrega.
+     */
+    class BufferDescompresion : public std::streambuf {
+    private:
+        std::FILE* archivo;
+        std::string nombreArchivo;
+        FormatoEntrada formato;
+
+        ColaSPSC<std::vector<char>> llenos;
+        ColaSPSC<std::vector<char>> libres;
+        std::vector<char> actual;
+        std::atomic<bool> error;
+        std::thread hilo;
+
+        bool entregar(std::vector<char>& bloque);
+        std::vector<char> bloqueLibre();
+        void fallar(const char* detalle);
+        void descomprimir();
+        void descomprimirGzip();
+        void descomprimirZstd();
+
+    protected:
+        int_type underflow() override;
+
+    public:
+        BufferDescompresion();
+        ~BufferDescompresion();
+
+        /**
+         * Empieza a descomprimir en el hilo; el buffer se queda con el archivo
+         */
+        void iniciar(std::FILE* archivoComprimido, const std::string& nombre, FormatoEntrada formatoArchivo);
+        bool iniciado() const;
+        bool huboError() const;
+    };
+
+    FormatoEntrada formato;
+    std::ifstream archivoTexto;
+    BufferDescompresion descompresion;
+    std::istream flujoComprimido;
+
+public:
+    explicit LectorEntrada(const std::string& nombreArchivo);
+    ~LectorEntrada();
+    LectorEntrada(const LectorEntrada&) = delete;
+    LectorEntrada& operator=(const LectorEntrada&) = delete;
+
+    /**
+     * El archivo se abrió y su formato está soportado en esta compilación
+     * (si no, ya se mostró el error)
+     */
+    bool abierto() const;
+
+    /**
+     * Texto del archivo, ya descomprimido
+     */
+    std::istream& flujo();
+
+    /**
+     * Los datos comprimidos estaban dañados o truncados; tiene sentido después
+     * de leer hasta el final (el flujo termina antes de tiempo y el error ya se
+     * mostró)
+     */
+    bool huboError() const;
+
+    FormatoEntrada getFormato() const;
+
+    /**
+     * Formato del archivo según su número mágico (TEXTO si no se puede leer)
+     */
+    static FormatoEntrada detectarFormato(const std::string& nombreArchivo);
+
+    /**
+     * Quita la extensión .gz o .zst del nombre, si la tiene
+     * (datos.txt.gz -> datos.txt), para nombrar las salidas como las de la
+     * entrada sin comprimir
+     */
+    static std::string quitarExtensionCompresion(const std::string& nombreArchivo);
+};
+
+#endif // LECTOR_ENTRADA_H
@@ -0,0 +1,68 @@
+#ifndef MAPA_NIVELES_H
+#define MAPA_NIVELES_H
+
+#include <vector>
+#include <cstdint>
+
+/**
+ * Mapa de bits de los niveles con procesos listos
+ *
+ * Un bit por nivel en palabras de 64 y una palabra de resumen con un bit por
+ * palabra no vacía: el nivel no vacío de mayor prioridad se obtiene con dos
+ * búsquedas del primer bit y saber si todos están vacíos es comparar el
+ * resumen con cero. Alcanza para MAX_NIVELES (64 × 64) niveles.
+ */
+class MapaNiveles {
+public:
+    static const int MAX_NIVELES = 64 * 64;
+
+private:
+    std::vector<uint64_t> palabras;
+    uint64_t resumen;
+
+public:
+    MapaNiveles() : resumen(0) {}
+
+    /**
+     * Vacía el mapa y lo dimensiona para la cantidad de niveles indicada
+     */
+    void reiniciar(int niveles) {
+        palabras.assign((niveles + 63) / 64, 0);
+        resumen = 0;
+    }
+
+    void limpiar() {
+        for (uint64_t& palabra : palabras) {
+            palabra = 0;
+        }
+        resumen = 0;
+    }
+
+    void marcar(int nivel) {
+        palabras[nivel >> 6] |= 1ULL << (nivel & 63);
+        resumen |= 1ULL << (nivel >> 6);
+    }
+
+    void desmarcar(int nivel) {
+        uint64_t& palabra = palabras[nivel >> 6];
+        palabra &= ~(1ULL << (nivel & 63));
+        if (palabra == 0) {
+            resumen &= ~(1ULL << (nivel >> 6));
+        }
+    }
+
+    /**
+     * Nivel no vacío de mayor prioridad (índice más bajo), o -1 si no hay
+     */
+    int primero() const {
+        if (resumen == 0) return -1;
+        int indicePalabra = __builtin_ctzll(resumen);
+        return (indicePalabra << 6) | __builtin_ctzll(palabras[indicePalabra]);
+    }
+
+    bool vacio() const {
+        return resumen == 0;
+    }
+};
+
+#endif // MAPA_NIVELES_H
@@ -0,0 +1,218 @@
+#include "ModoLote.h"
+#include "ArchivoUtils.h"
+#include "PlanificadorMLFQ.h"
+#include "PoolHilos.h"
+#include "CacheResultados.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <exception>
+#include <cctype>
+
+namespace {
+
+/**
+ * Procesos leídos de un archivo, compartidos por sus configuraciones
+ */
+struct CargaArchivo {
+    std::vector<Proceso*> procesos;
+    
+    explicit CargaArchivo(std::vector<Proceso*> leidos) : procesos(std::move(leidos)) {}
+    ~CargaArchivo() {
+        for (Proceso* proceso : procesos) {
+            delete proceso;
+        }
+    }
+    
+    CargaArchivo(const CargaArchivo&) = delete;
+    CargaArchivo& operator=(const CargaArchivo&) = delete;
+};
+
+/**
+ * Simula (o restaura de la caché) una configuración sobre una copia de los
+ * procesos del archivo y escribe sus salidas
+ */
+void simularConfiguracion(const OpcionesLote& opciones, CacheResultados& cache, const std::string& archivo,
+                          char letra, const std::vector<Proceso*>& originales,
+                          ResumenGuardado& metricas, bool& enCache) {
+    std::string nombreConfig = std::string("Config") + letra;
+    std::vector<ConfiguracionCola> configuraciones;
+    PlanificadorMLFQ::obtenerConfiguracionPredefinida(letra, configuraciones);
+    
+    PlanificadorMLFQ planificador;
+    planificador.setFusionarHistorial(opciones.fusionarHistorial);
+    if (opciones.quantumAdaptativo) {
+        planificador.activarQuantumAdaptativo(opciones.controlQuantum);
+    }
+    planificador.setModeloCostos(opciones.modeloCostos);
+    planificador.configurarColas(configuraciones);
+    
+    std::string archivoSalida = ArchivoUtils::generarNombreSalida(archivo, "_" + nombreConfig);
+    std::string archivoReporte = ArchivoUtils::generarNombreSalida(archivo, "_" + nombreConfig + "_detalle");
+    std::string clave;
+    enCache = false;
+    if (cache.activa()) {
+        clave = CacheResultados::calcularClave(originales, planificador);
+        enCache = cache.restaurar(clave, archivoSalida, archivoReporte, metricas);
+    }
+    if (enCache) {
+        return;
+    }
+    
+    // Las copias se liberan aquí (no con limpiarProcesos) también si algo lanza una excepción
+    std::vector<std::unique_ptr<Proceso>> copias;
+    std::vector<Proceso*> procesos;
+    copias.reserve(originales.size());
+    procesos.reserve(originales.size());
+    for (const Proceso* original : originales) {
+        copias.push_back(std::unique_ptr<Proceso>(new Proceso(*original)));
+        procesos.push_back(copias.back().get());
+        planificador.agregarProceso(procesos.back());
+    }
+    planificador.ejecutarSimulacion();
+    
+    ArchivoUtils::escribirResultados(archivoSalida, procesos, planificador);
+    ArchivoUtils::escribirReporteDetallado(archivoReporte, planificador);
+    
+    metricas.procesos = procesos.size();
+    metricas.promedioWT = planificador.getPromedioWT();
+    metricas.promedioCT = planificador.getPromedioCT();
+    metricas.promedioRT = planificador.getPromedioRT();
+    metricas.promedioTAT = planificador.getPromedioTAT();
+    if (cache.activa()) {
+        cache.guardar(clave, archivoSalida, archivoReporte, metricas);
+    }
+}
+
+} // namespace
+
+/**
+ * Ejecuta el modo por lotes
+ */
+int ModoLote::ejecutar(const OpcionesLote& opciones) {
+    std::vector<std::string> archivos = ArchivoUtils::listarArchivos(opciones.patron);
+    if (archivos.empty()) {
+        std::cerr << "Error: No se encontraron archivos de entrada en " << opciones.patron << std::endl;
+        return 1;
+    }
+    
+    // Validar configuraciones solicitadas
+    std::vector<char> letras;
+    for (char letra : opciones.configuraciones) {
+        std::vector<ConfiguracionCola> configuraciones;
+        if (!PlanificadorMLFQ::obtenerConfiguracionPredefinida(letra, configuraciones)) {
+            std::cerr << "Error: Configuración desconocida '" << letra << "'" << std::endl;
+            return 1;
+        }
+        letras.push_back(static_cast<char>(toupper(static_cast<unsigned char>(letra))));
+    }
+    
+    // Ubicar la tabla resumen junto a las entradas si no se indicó otra ruta
+    std::string archivoResumen = opciones.archivoResumen;
+    if (archivoResumen.empty()) {
+        size_t barra = archivos[0].find_last_of("/\\");
+        archivoResumen = (barra == std::string::npos ? std::string("") : archivos[0].substr(0, barra + 1))
+                         + "resumen_lote.txt";
+    }
+    
+    std::ofstream resumen(archivoResumen);
+    if (!resumen.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << archivoResumen << std::endl;
+        return 1;
+    }
+    resumen << "# Resumen de simulación MLFQ por lotes" << std::endl;
+    resumen << "# Formato: archivo;configuracion;procesos;WT;CT;RT;TAT" << std::endl;
+    resumen << "archivo;configuracion;procesos;WT;CT;RT;TAT" << std::endl;
+    resumen << std::fixed << std::setprecision(2);
+    
+    ArchivoUtils::setModoSilencioso(true);
+    ArchivoUtils::setHilosEscritura(1);     // El pool ya ocupa todos los hilos
+    CacheResultados cache(opciones.directorioCache, opciones.bytesCache);
+    
+    std::mutex mutexResumen;
+    std::atomic<int> completadas(0);
+    std::atomic<int> fallidas(0);
+    int total = static_cast<int>(archivos.size() * letras.size());
+    auto inicio = std::chrono::steady_clock::now();
+    
+    {
+        PoolHilos pool(opciones.hilos);
+        std::cout << "Procesando " << archivos.size() << " archivos x " << letras.size()
+                  << " configuraciones con " << pool.getNumHilos() << " hilos..." << std::endl;
+        
+        // Cada archivo se interpreta una vez; sus configuraciones se envían
+        // al pool desde la misma tarea y comparten los procesos leídos
+        for (const std::string& archivo : archivos) {
+            pool.enviar([&, archivo]() {
+                std::shared_ptr<CargaArchivo> carga;
+                try {
+                    carga = std::make_shared<CargaArchivo>(ArchivoUtils::leerArchivoProcesos(archivo));
+                } catch (const std::exception& e) {
+                    fallidas += static_cast<int>(letras.size());
+                    std::lock_guard<std::mutex> lock(mutexResumen);
+                    std::cerr << "Error: " << archivo << ": " << e.what() << std::endl;
+                    return;
+                }
+                
+                if (carga->procesos.empty()) {
+                    fallidas += static_cast<int>(letras.size());
+                    std::lock_guard<std::mutex> lock(mutexResumen);
+                    std::cerr << "Error: Sin procesos válidos en " << archivo << std::endl;
+                    return;
+                }
+                
+                for (char letra : letras) {
+                    pool.enviar([&, archivo, letra, carga]() {
+                        std::string nombreConfig = std::string("Config") + letra;
+                        ResumenGuardado metricas;
+                        bool enCache = false;
+                        try {
+                            simularConfiguracion(opciones, cache, archivo, letra, carga->procesos,
+                                                 metricas, enCache);
+                        } catch (const std::exception& e) {
+                            // Una tarea que falla no debe terminar el proceso: cuenta como fallida
+                            fallidas++;
+                            std::lock_guard<std::mutex> lock(mutexResumen);
+                            std::cerr << "Error: " << archivo << " " << nombreConfig << ": " << e.what()
+                                      << std::endl;
+                            return;
+                        }
+                        
+                        // La fila se vuelca inmediatamente para poder seguir el avance
+                        std::lock_guard<std::mutex> lock(mutexResumen);
+                        resumen << archivo << ";" << nombreConfig << ";" << metricas.procesos << ";"
+                                << metricas.promedioWT << ";"
+                                << metricas.promedioCT << ";"
+                                << metricas.promedioRT << ";"
+                                << metricas.promedioTAT << std::endl;
+                        
+                        int hechas = ++completadas;
+                        std::cout << "[" << hechas << "/" << total << "] " << archivo
+                                  << " " << nombreConfig << (enCache ? " (caché)" : "") << std::endl;
+                    });
+                }
+            });
+        }
+        
+        pool.esperar();
+    }
+    
+    ArchivoUtils::setHilosEscritura(0);
+    ArchivoUtils::setModoSilencioso(false);
+    resumen.close();
+    
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << "Lote completado: " << completadas << " simulaciones, " << fallidas
+              << " fallidas en " << std::fixed << std::setprecision(2) << segundos << " s" << std::endl;
+    std::cout << "Resumen escrito en: " << archivoResumen << std::endl;
+    if (cache.activa()) {
+        std::cout << "Caché de resultados: " << cache.getAciertos() << " aciertos, "
+                  << cache.getFallos() << " fallos" << std::endl;
+    }
+    
+    return fallidas > 0 ? 1 : 0;
+}
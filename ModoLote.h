@@ -0,0 +1,41 @@
+#ifndef MODO_LOTE_H
+#define MODO_LOTE_H
+
+#include <string>
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Opciones del modo por lotes
+ */
+struct OpcionesLote {
+    std::string patron;             // Directorio o patrón de archivos (p. ej. Pruebas/mlq*.txt)
+    std::string configuraciones;    // Letras de las configuraciones a ejecutar (p. ej. "ABC")
+    int hilos;                      // Hilos del pool (0 = todos los disponibles)
+    std::string archivoResumen;     // Tabla agregada (vacío = resumen_lote.txt junto a las entradas)
+    bool fusionarHistorial;         // Fusionar intervalos consecutivos en los reportes detallados
+    bool quantumAdaptativo;         // Ajustar los quantums RR durante cada simulación
+    ParametrosControlQuantum controlQuantum;
+    ModeloCostos modeloCostos;      // Costo de cambios de contexto y recarga de caché
+    std::string directorioCache;    // Resultados guardados por contenido (vacío = sin caché)
+    unsigned long long bytesCache;  // Tamaño máximo de la caché de resultados
+    
+    OpcionesLote() : configuraciones("ABC"), hilos(0), fusionarHistorial(false), quantumAdaptativo(false),
+                     bytesCache(512ULL << 20) {}
+};
+
+/**
+ * Ejecuta sin interacción todas las combinaciones archivo × configuración
+ * repartidas en un pool de hilos con robo de trabajo
+ */
+class ModoLote {
+public:
+    /**
+     * Procesa todos los archivos: escribe las salidas habituales de cada uno
+     * (_ConfigX.txt y _ConfigX_detalle.txt) y una tabla resumen con una fila
+     * por archivo y configuración, que se vuelca a disco a medida que terminan
+     * @return 0 si todas las simulaciones terminaron correctamente
+     */
+    static int ejecutar(const OpcionesLote& opciones);
+};
+
+#endif // MODO_LOTE_H
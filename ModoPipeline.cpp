@@ -0,0 +1,452 @@
+#include "ModoPipeline.h"
+#include "ColaSPSC.h"
+#include "FuenteOrdenExterno.h"
+#include "ArchivoUtils.h"
+#include "PlanificadorMLFQ.h"
+#include "ExportadorTraza.h"
+#include "LectorEntrada.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+#include <map>
+#include <unordered_map>
+#include <chrono>
+#include <memory>
+#include <cstdio>
+#include <cctype>
+
+namespace {
+
+/**
+ * Proceso leído junto con su posición en el archivo de entrada
+ */
+struct LlegadaLeida {
+    Proceso* proceso;
+    size_t indice;
+};
+
+/**
+ * Fila del archivo de resultados de un proceso terminado
+ */
+struct FilaResultado {
+    size_t indice;              // Posición del proceso en el archivo de entrada
+    std::string etiqueta;
+    int burstTime;
+    int tiempoES;               // Suma de ráfagas de E/S (no cuenta como espera)
+    int arrivalTime;
+    int queueLevel;
+    int priority;
+    int completionTime;
+    int responseTime;
+};
+
+/**
+ * Etapa 1: interpreta el archivo y entrega los procesos en orden
+ */
+void etapaLectura(const std::string& nombreArchivo, ColaSPSC<LlegadaLeida>& salida,
+                  std::atomic<bool>& desordenado, std::atomic<bool>& errorLectura) {
+    LectorEntrada lector(nombreArchivo);
+    if (!lector.abierto()) {
+        std::cerr << "Error: No se pudo abrir el archivo " << nombreArchivo << std::endl;
+        errorLectura = true;
+        salida.cerrar();
+        return;
+    }
+    std::istream& archivo = lector.flujo();
+
+    std::string linea;
+    int numeroLinea = 0;
+    int ultimaLlegada = 0;
+    size_t leidos = 0;
+
+    while (std::getline(archivo, linea)) {
+        numeroLinea++;
+        Proceso* proceso = ArchivoUtils::interpretarLinea(linea, numeroLinea);
+        if (proceso == nullptr) {
+            continue;
+        }
+
+        // El planificador consume en orden: una llegada anterior invalida la lectura directa
+        if (proceso->getArrivalTime() < ultimaLlegada) {
+            desordenado = true;
+            delete proceso;
+            break;
+        }
+        ultimaLlegada = proceso->getArrivalTime();
+        salida.encolar(LlegadaLeida{proceso, leidos++});
+    }
+
+    // Un archivo comprimido truncado o dañado termina el getline como un fin normal
+    if (lector.huboError()) {
+        errorLectura = true;
+    }
+    salida.cerrar();
+}
+
+/**
+ * Etapa 1 para entradas desordenadas: mezcla de los tramos ya ordenados
+ */
+void etapaMezcla(FuenteOrdenExterno& fuente, ColaSPSC<LlegadaLeida>& salida) {
+    Proceso* proceso;
+    while ((proceso = fuente.siguienteLlegada()) != nullptr) {
+        salida.encolar(LlegadaLeida{proceso, fuente.getUltimoIndice()});
+    }
+    salida.cerrar();
+}
+
+/**
+ * Etapa 2 (en el hilo del planificador): fuente de llegadas que lee de la
+ * etapa 1 y observador que reenvía historial y procesos terminados a la etapa 3
+ */
+class EnlaceSimulacion : public FuenteLlegadas, public ObservadorEjecucion {
+private:
+    ColaSPSC<LlegadaLeida>& entrada;
+    ColaSPSC<RegistroEjecucion>& historial;
+    ColaSPSC<FilaResultado>& filas;
+    std::unordered_map<const Proceso*, size_t> pendientes;  // Procesos entregados sin terminar
+    size_t entregados;
+    size_t registros;
+
+    void enviarFila(const Proceso* proceso, size_t indice) {
+        FilaResultado fila;
+        fila.indice = indice;
+        fila.etiqueta = proceso->getEtiqueta();
+        fila.burstTime = proceso->getBurstTime();
+        fila.tiempoES = proceso->getTiempoES();
+        fila.arrivalTime = proceso->getArrivalTime();
+        fila.queueLevel = proceso->getQueueLevel();
+        fila.priority = proceso->getPriority();
+        fila.completionTime = proceso->getCompletionTime();
+        fila.responseTime = proceso->getResponseTime();
+        filas.encolar(std::move(fila));
+    }
+
+public:
+    EnlaceSimulacion(ColaSPSC<LlegadaLeida>& entrada, ColaSPSC<RegistroEjecucion>& historial,
+                     ColaSPSC<FilaResultado>& filas)
+        : entrada(entrada), historial(historial), filas(filas), entregados(0), registros(0) {}
+
+    Proceso* siguienteLlegada() override {
+        LlegadaLeida llegada;
+        if (!entrada.desencolar(llegada)) {
+            return nullptr;
+        }
+        pendientes[llegada.proceso] = llegada.indice;
+        entregados++;
+        return llegada.proceso;
+    }
+
+    void registroCerrado(const RegistroEjecucion& registro) override {
+        historial.encolar(registro);
+        registros++;
+    }
+
+    void procesoCompletado(const Proceso* proceso) override {
+        auto entrada = pendientes.find(proceso);
+        if (entrada != pendientes.end()) {
+            enviarFila(proceso, entrada->second);
+            pendientes.erase(entrada);
+        }
+    }
+
+    /**
+     * Envía los procesos que nunca terminaron (p. ej. nivel de cola inexistente)
+     * y cierra las colas hacia el escritor
+     */
+    void finalizar() {
+        for (const auto& pendiente : pendientes) {
+            enviarFila(pendiente.first, pendiente.second);
+        }
+        pendientes.clear();
+        historial.cerrar();
+        filas.cerrar();
+    }
+
+    size_t getEntregados() const { return entregados; }
+    size_t getRegistros() const { return registros; }
+};
+
+/**
+ * Etapa 3: escribe el historial a medida que llega y las filas de resultados
+ * en el orden del archivo de entrada
+ */
+class EtapaEscritura {
+private:
+    ColaSPSC<RegistroEjecucion>& historial;
+    ColaSPSC<FilaResultado>& filas;
+    AvisoCola& aviso;                           // Compartido por ambas colas
+    std::ofstream resultados;
+    std::ofstream detalle;
+    std::map<size_t, FilaResultado> enEspera;   // Filas que llegaron antes que las anteriores
+    size_t siguienteFila;
+
+    void escribirFila(const FilaResultado& fila) {
+        // Mismo cálculo que Proceso::calcularTiempos / KernelsMetricas::calcularTiempos
+        int turnaroundTime = fila.completionTime > 0 ? fila.completionTime - fila.arrivalTime : 0;
+        int waitingTime = fila.completionTime > 0 ? turnaroundTime - fila.burstTime - fila.tiempoES : 0;
+        resultados << fila.etiqueta << ";"
+                   << fila.burstTime << ";"
+                   << fila.arrivalTime << ";"
+                   << fila.queueLevel << ";"
+                   << fila.priority << ";"
+                   << waitingTime << ";"
+                   << fila.completionTime << ";"
+                   << fila.responseTime << ";"
+                   << turnaroundTime << "\n";
+    }
+
+    void recibirFila(FilaResultado& fila) {
+        if (fila.indice != siguienteFila) {
+            size_t indice = fila.indice;
+            enEspera[indice] = std::move(fila);
+            return;
+        }
+
+        escribirFila(fila);
+        siguienteFila++;
+        auto espera = enEspera.begin();
+        while (espera != enEspera.end() && espera->first == siguienteFila) {
+            escribirFila(espera->second);
+            siguienteFila++;
+            espera = enEspera.erase(espera);
+        }
+    }
+
+public:
+    EtapaEscritura(ColaSPSC<RegistroEjecucion>& historial, ColaSPSC<FilaResultado>& filas, AvisoCola& aviso)
+        : historial(historial), filas(filas), aviso(aviso), siguienteFila(0) {}
+
+    bool abrir(const std::string& archivoResultados, const std::string& archivoDetalle) {
+        resultados.open(archivoResultados);
+        detalle.open(archivoDetalle);
+        if (!resultados.is_open() || !detalle.is_open()) {
+            std::cerr << "Error: No se pudo crear el archivo "
+                      << (resultados.is_open() ? archivoDetalle : archivoResultados) << std::endl;
+            return false;
+        }
+        resultados << ArchivoUtils::encabezadoResultados();
+        detalle << ArchivoUtils::encabezadoDetalle();
+        return true;
+    }
+
+    /**
+     * Cuerpo del hilo escritor: atiende ambas colas hasta que se cierren
+     */
+    void ejecutar() {
+        RegistroEjecucion registro;
+        FilaResultado fila;
+        while (true) {
+            bool avance = false;
+            while (historial.intentarDesencolar(registro)) {
+                detalle << registro.etiquetaProceso << ";"
+                        << registro.tiempoInicio << ";"
+                        << registro.tiempoFin << ";"
+                        << registro.nivelCola << ";"
+                        << registro.algoritmo << "\n";
+                avance = true;
+            }
+            while (filas.intentarDesencolar(fila)) {
+                recibirFila(fila);
+                avance = true;
+            }
+            if (!avance) {
+                if (historial.terminada() && filas.terminada()) {
+                    break;
+                }
+                aviso.esperar([this] {
+                    return !historial.vacia() || !filas.vacia() || (historial.terminada() && filas.terminada());
+                });
+            }
+        }
+    }
+
+    /**
+     * Agrega los promedios (conocidos al terminar la simulación) y cierra
+     */
+    void terminar(const PlanificadorMLFQ& planificador) {
+        resultados << ArchivoUtils::promediosResultados(planificador.getPromedioWT(),
+                                                       planificador.getPromedioCT(),
+                                                       planificador.getPromedioRT(),
+                                                       planificador.getPromedioTAT());
+        resultados << ArchivoUtils::sobrecargaResultados(planificador);
+        detalle << ArchivoUtils::cambiosQuantumDetalle(planificador);
+        detalle << ArchivoUtils::promediosDetalle(planificador);
+        resultados.close();
+        detalle.close();
+    }
+};
+
+/**
+ * Estado de una ejecución de la tubería
+ */
+struct ResultadoTuberia {
+    bool correcto;
+    bool desordenado;
+    bool errorLectura;          // La entrada no se pudo leer completa
+    size_t procesos;
+    size_t registros;
+};
+
+/**
+ * Ejecuta una configuración con las tres etapas. Sin fuente externa, la etapa 1
+ * lee el archivo directamente (debe estar ordenado por llegada).
+ */
+ResultadoTuberia ejecutarTuberia(const OpcionesPipeline& opciones,
+                                 const std::vector<ConfiguracionCola>& configuraciones,
+                                 FuenteOrdenExterno* fuenteExterna,
+                                 const std::string& nombreConfig,
+                                 const std::string& archivoResultados, const std::string& archivoDetalle) {
+    ResultadoTuberia resultado = {false, false, false, 0, 0};
+
+    // El escritor atiende dos colas: duerme hasta que cualquiera de ellas cambie
+    AvisoCola avisoEscritura;
+    ColaSPSC<LlegadaLeida> colaProcesos(opciones.capacidadCola);
+    ColaSPSC<RegistroEjecucion> colaHistorial(opciones.capacidadCola, &avisoEscritura);
+    ColaSPSC<FilaResultado> colaFilas(opciones.capacidadCola, &avisoEscritura);
+
+    EtapaEscritura escritura(colaHistorial, colaFilas, avisoEscritura);
+    if (!escritura.abrir(archivoResultados, archivoDetalle)) {
+        return resultado;
+    }
+
+    std::atomic<bool> desordenado(false);
+    std::atomic<bool> errorLectura(false);
+    std::thread lector;
+    if (fuenteExterna != nullptr) {
+        lector = std::thread(etapaMezcla, std::ref(*fuenteExterna), std::ref(colaProcesos));
+    } else {
+        lector = std::thread(etapaLectura, std::cref(opciones.archivo), std::ref(colaProcesos),
+                             std::ref(desordenado), std::ref(errorLectura));
+    }
+    std::thread escritor(&EtapaEscritura::ejecutar, &escritura);
+
+    EnlaceSimulacion enlace(colaProcesos, colaHistorial, colaFilas);
+    PlanificadorMLFQ planificador;
+    planificador.setFusionarHistorial(opciones.fusionarHistorial);
+    if (opciones.quantumAdaptativo) {
+        planificador.activarQuantumAdaptativo(opciones.controlQuantum);
+    }
+    planificador.setModeloCostos(opciones.modeloCostos);
+    planificador.setFuenteLlegadas(&enlace);
+    planificador.setObservador(&enlace);
+    planificador.setGuardarHistorial(false);
+    planificador.configurarColas(configuraciones);
+    
+    // La traza se escribe desde el hilo de simulación y reenvía los eventos al enlace
+    ExportadorTraza exportador(&enlace);
+    if (opciones.traza &&
+        exportador.abrir(ExportadorTraza::nombreArchivo(opciones.archivo, "_" + nombreConfig), nombreConfig,
+                         configuraciones)) {
+        planificador.setObservador(&exportador);
+    }
+    planificador.ejecutarSimulacion();
+    enlace.finalizar();
+    exportador.cerrar();
+
+    lector.join();
+    escritor.join();
+    escritura.terminar(planificador);
+    planificador.limpiarProcesos();
+
+    resultado.correcto = true;
+    resultado.desordenado = desordenado;
+    resultado.errorLectura = errorLectura;
+    resultado.procesos = enlace.getEntregados();
+    resultado.registros = enlace.getRegistros();
+    return resultado;
+}
+
+} // namespace
+
+/**
+ * Ejecuta el modo en tubería
+ */
+int ModoPipeline::ejecutar(const OpcionesPipeline& opciones) {
+    if (!ArchivoUtils::validarArchivo(opciones.archivo)) {
+        std::cerr << "Error: No se pudo encontrar o leer el archivo: " << opciones.archivo << std::endl;
+        return 1;
+    }
+
+    std::unique_ptr<FuenteOrdenExterno> fuenteExterna;     // Se crea al detectar entrada desordenada
+    std::vector<std::string> escritos;                     // Salidas de esta ejecución
+    int fallidas = 0;
+
+    // Con la entrada incompleta ningún resultado vale: se borra todo lo escrito
+    auto abortarLectura = [&]() {
+        std::cerr << "Error: No se pudo procesar completa la entrada " << opciones.archivo
+                  << "; se descartan los resultados" << std::endl;
+        for (const std::string& salida : escritos) {
+            std::remove(salida.c_str());
+        }
+        return 1;
+    };
+
+    for (char letra : opciones.configuraciones) {
+        std::vector<ConfiguracionCola> configuraciones;
+        if (!PlanificadorMLFQ::obtenerConfiguracionPredefinida(letra, configuraciones)) {
+            std::cerr << "Error: Configuración desconocida '" << letra << "'" << std::endl;
+            return 1;
+        }
+        std::string nombreConfig = std::string("Config") +
+                                   static_cast<char>(toupper(static_cast<unsigned char>(letra)));
+        std::string archivoResultados = ArchivoUtils::generarNombreSalida(opciones.archivo, "_" + nombreConfig);
+        std::string archivoDetalle = ArchivoUtils::generarNombreSalida(opciones.archivo,
+                                                                       "_" + nombreConfig + "_detalle");
+        std::string archivoTraza = ExportadorTraza::nombreArchivo(opciones.archivo, "_" + nombreConfig);
+        escritos.push_back(archivoResultados);
+        escritos.push_back(archivoDetalle);
+        if (opciones.traza) {
+            escritos.push_back(archivoTraza);
+        }
+
+        auto inicio = std::chrono::steady_clock::now();
+        
+        if (fuenteExterna && !fuenteExterna->reiniciar()) {
+            return 1;
+        }
+        ResultadoTuberia resultado = ejecutarTuberia(opciones, configuraciones, fuenteExterna.get(),
+                                                     nombreConfig, archivoResultados, archivoDetalle);
+        if (resultado.errorLectura) {
+            return abortarLectura();
+        }
+        if (resultado.correcto && resultado.desordenado) {
+            // Entrada desordenada: se ordena por tramos una vez y se reutiliza
+            std::cout << "La entrada no está ordenada por llegada; ordenando por tramos de "
+                      << opciones.procesosPorTramo << " procesos..." << std::endl;
+            fuenteExterna.reset(new FuenteOrdenExterno(opciones.archivo, opciones.procesosPorTramo));
+            if (!fuenteExterna->preparar()) {
+                return abortarLectura();
+            }
+            resultado = ejecutarTuberia(opciones, configuraciones, fuenteExterna.get(),
+                                        nombreConfig, archivoResultados, archivoDetalle);
+        }
+        
+        if (!resultado.correcto) {
+            return 1;
+        }
+        
+        if (resultado.procesos == 0) {
+            std::cerr << "Error: Sin procesos válidos en " << opciones.archivo << std::endl;
+            std::remove(archivoResultados.c_str());
+            std::remove(archivoDetalle.c_str());
+            if (opciones.traza) {
+                std::remove(archivoTraza.c_str());
+            }
+            fallidas++;
+            continue;
+        }
+
+        double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        std::cout << nombreConfig << ": " << resultado.procesos << " procesos, "
+                  << resultado.registros << " registros en " << std::fixed << std::setprecision(2)
+                  << segundos << " s -> " << archivoResultados << ", " << archivoDetalle;
+        if (opciones.traza) {
+            std::cout << ", " << archivoTraza;
+        }
+        std::cout << std::endl;
+    }
+
+    return fallidas > 0 ? 1 : 0;
+}
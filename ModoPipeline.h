@@ -0,0 +1,49 @@
+#ifndef MODO_PIPELINE_H
+#define MODO_PIPELINE_H
+
+#include <string>
+#include <cstddef>
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Opciones del modo en tubería
+ */
+struct OpcionesPipeline {
+    std::string archivo;            // Archivo de entrada (lectura directa si está ordenado por llegada)
+    std::string configuraciones;    // Letras de las configuraciones a ejecutar (p. ej. "ABC")
+    bool fusionarHistorial;         // Fusionar intervalos consecutivos en el reporte detallado
+    size_t capacidadCola;           // Elementos por cola entre etapas
+    size_t procesosPorTramo;        // Procesos en memoria por tramo al ordenar entradas desordenadas
+    bool quantumAdaptativo;         // Ajustar los quantums RR durante la simulación
+    ParametrosControlQuantum controlQuantum;
+    ModeloCostos modeloCostos;      // Costo de cambios de contexto y recarga de caché
+    bool traza;                     // Escribir también <base>_ConfigX_traza.json
+
+    OpcionesPipeline()
+        : configuraciones("ABC"), fusionarHistorial(false), capacidadCola(4096), procesosPorTramo(1 << 20),
+          quantumAdaptativo(false), traza(false) {}
+};
+
+/**
+ * Ejecuta lectura, simulación y escritura como tres etapas concurrentes
+ *
+ * Un hilo interpreta el archivo y entrega los procesos al planificador por una
+ * cola SPSC acotada; el planificador simula a medida que llegan (la entrada
+ * ya viene ordenada por llegada) y envía por otras dos colas los registros del
+ * historial y los procesos terminados a un hilo escritor. El tiempo total se
+ * acerca al de la etapa más lenta en lugar de la suma de las tres.
+ *
+ * Los archivos generados son los mismos que en el modo interactivo. Si la
+ * entrada no está ordenada por llegada, se ordena por tramos en disco
+ * (FuenteOrdenExterno) y la etapa 1 pasa a ser la mezcla de esos tramos.
+ */
+class ModoPipeline {
+public:
+    /**
+     * Ejecuta cada configuración solicitada sobre el archivo
+     * @return 0 si todas las simulaciones terminaron correctamente
+     */
+    static int ejecutar(const OpcionesPipeline& opciones);
+};
+
+#endif // MODO_PIPELINE_H
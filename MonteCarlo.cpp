@@ -0,0 +1,308 @@
+#include "MonteCarlo.h"
+#include "PoolHilos.h"
+#include "MotorCarriles.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include <cctype>
+
+namespace {
+
+const int PASO_EVALUACION = 16;     // Réplicas entre evaluaciones del criterio de parada
+
+/**
+ * Media y varianza incrementales (algoritmo de Welford)
+ */
+struct Acumulador {
+    long long n;
+    double media;
+    double m2;
+
+    Acumulador() : n(0), media(0), m2(0) {}
+
+    void agregar(double valor) {
+        n++;
+        double delta = valor - media;
+        media += delta / n;
+        m2 += delta * (valor - media);
+    }
+
+    EstimacionMetrica estimar(double z) const {
+        EstimacionMetrica estimacion;
+        estimacion.media = media;
+        estimacion.semiancho = n > 1 ? z * std::sqrt(m2 / (n - 1) / n) : 0.0;
+        return estimacion;
+    }
+};
+
+/**
+ * Promedios WT, RT y TAT de una configuración sobre una réplica
+ */
+struct MuestraReplica {
+    double wt;
+    double rt;
+    double tat;
+};
+
+} // namespace
+
+/**
+ * Genera una carga aleatoria. Cada réplica usa un flujo de números aleatorios
+ * propio derivado de (semilla, réplica), así el resultado no depende de qué
+ * hilo la ejecute ni del número de hilos.
+ */
+std::vector<Proceso*> MonteCarlo::generarCarga(const ParametrosCarga& parametros,
+                                               uint64_t semilla, uint64_t replica) {
+    std::seed_seq secuencia = {
+        static_cast<uint32_t>(semilla), static_cast<uint32_t>(semilla >> 32),
+        static_cast<uint32_t>(replica), static_cast<uint32_t>(replica >> 32)
+    };
+    std::mt19937_64 generador(secuencia);
+
+    std::exponential_distribution<double> rafaga(1.0 / std::max(1e-9, parametros.mediaRafaga));
+    std::exponential_distribution<double> entreLlegadas(
+        1.0 / std::max(1e-9, parametros.mediaEntreLlegadas));
+    std::uniform_int_distribution<int> nivel(1, std::max(1, parametros.nivelInicialMaximo));
+
+    std::vector<Proceso*> procesos;
+    procesos.reserve(parametros.numProcesos);
+    int llegada = 0;
+    for (int i = 0; i < parametros.numProcesos; i++) {
+        if (i > 0 && parametros.mediaEntreLlegadas > 0) {
+            llegada += static_cast<int>(std::lround(entreLlegadas(generador)));
+        }
+        int burstTime = std::max(1, static_cast<int>(std::ceil(rafaga(generador))));
+        procesos.push_back(new Proceso("P" + std::to_string(i + 1), burstTime, llegada,
+                                       nivel(generador), 1));
+    }
+    return procesos;
+}
+
+/**
+ * Ejecuta réplicas por lotes hasta resolver el ranking o alcanzar el tope
+ */
+ResultadoMonteCarlo MonteCarlo::ejecutar(const OpcionesMonteCarlo& opciones) {
+    ResultadoMonteCarlo resultado;
+    resultado.replicas = 0;
+    resultado.rankingResuelto = false;
+
+    std::vector<std::string> nombres;
+    std::vector<std::vector<ConfiguracionCola>> configuraciones;
+    for (char letra : opciones.configuraciones) {
+        std::vector<ConfiguracionCola> configuracion;
+        if (!PlanificadorMLFQ::obtenerConfiguracionPredefinida(letra, configuracion)) {
+            std::cerr << "Error: Configuración desconocida '" << letra << "'" << std::endl;
+            return resultado;
+        }
+        nombres.push_back(std::string("Config") +
+                          static_cast<char>(toupper(static_cast<unsigned char>(letra))));
+        configuraciones.push_back(configuracion);
+    }
+    if (configuraciones.empty() || opciones.carga.numProcesos <= 0) {
+        return resultado;
+    }
+
+    size_t numConfigs = configuraciones.size();
+    double z = cuantilNormal(0.5 + opciones.confianza / 2.0);
+
+    std::vector<Acumulador> wt(numConfigs), rt(numConfigs), tat(numConfigs);
+    // Diferencias pareadas de TAT para cada par (i, j), i < j: TAT(j) - TAT(i)
+    std::vector<std::vector<Acumulador>> diferencias(numConfigs, std::vector<Acumulador>(numConfigs));
+
+    PoolHilos pool(opciones.hilos);
+    // Las cargas pequeñas se simulan de a CARRILES réplicas con el motor de carriles
+    bool usarCarriles = opciones.carga.numProcesos <= MotorCarriles::MAX_PROCESOS;
+    int replicasPorTarea = usarCarriles ? MotorCarriles::CARRILES : 1;
+    int tamLote = usarCarriles ? std::max(16, pool.getNumHilos() * 2 * MotorCarriles::CARRILES)
+                               : std::max(16, pool.getNumHilos() * 4);
+    int replicasMaximas = std::max(opciones.replicasMaximas, 1);
+    int replicasMinimas = std::max(2, std::min(opciones.replicasMinimas, replicasMaximas));
+
+    std::vector<std::vector<MuestraReplica>> muestras;
+    std::vector<size_t> orden(numConfigs);
+
+    // Ordena por TAT medio y verifica que cada par consecutivo del ranking
+    // tenga una diferencia pareada cuyo intervalo no contenga 0
+    auto evaluarRanking = [&]() {
+        for (size_t i = 0; i < numConfigs; i++) {
+            orden[i] = i;
+        }
+        std::stable_sort(orden.begin(), orden.end(), [&tat](size_t a, size_t b) {
+            return tat[a].media < tat[b].media;
+        });
+
+        resultado.comparaciones.clear();
+        bool resuelto = true;
+        for (size_t r = 0; r + 1 < numConfigs; r++) {
+            size_t mejor = orden[r];
+            size_t peor = orden[r + 1];
+            EstimacionMetrica diferencia = mejor < peor
+                ? diferencias[mejor][peor].estimar(z)
+                : diferencias[peor][mejor].estimar(z);
+            if (mejor > peor) {
+                diferencia.media = -diferencia.media;
+            }
+
+            ComparacionPareada comparacion;
+            comparacion.mejor = nombres[mejor];
+            comparacion.peor = nombres[peor];
+            comparacion.diferenciaTAT = diferencia;
+            comparacion.resuelta = diferencia.media - diferencia.semiancho > 0;
+            resuelto = resuelto && comparacion.resuelta;
+            resultado.comparaciones.push_back(comparacion);
+        }
+        return resuelto;
+    };
+
+    while (resultado.replicas < replicasMaximas) {
+        int inicio = resultado.replicas;
+        int cantidad = std::min(tamLote, replicasMaximas - inicio);
+        muestras.assign(cantidad, std::vector<MuestraReplica>(numConfigs));
+
+        for (int primera = 0; usarCarriles && primera < cantidad; primera += replicasPorTarea) {
+            int ultima = std::min(cantidad, primera + replicasPorTarea);
+            pool.enviar([&, primera, ultima, inicio]() {
+                std::vector<std::vector<Proceso*>> cargas;
+                for (int k = primera; k < ultima; k++) {
+                    cargas.push_back(generarCarga(opciones.carga, opciones.semilla,
+                                                  static_cast<uint64_t>(inicio + k)));
+                }
+                std::vector<ResultadoCarga> resultados;
+                for (size_t c = 0; c < numConfigs; c++) {
+                    MotorCarriles motor(configuraciones[c]);
+                    motor.simular(cargas, resultados);
+                    for (int k = primera; k < ultima; k++) {
+                        muestras[k][c].wt = resultados[k - primera].promedioWT;
+                        muestras[k][c].rt = resultados[k - primera].promedioRT;
+                        muestras[k][c].tat = resultados[k - primera].promedioTAT;
+                    }
+                }
+                for (std::vector<Proceso*>& procesos : cargas) {
+                    for (Proceso* proceso : procesos) {
+                        delete proceso;
+                    }
+                }
+            });
+        }
+        for (int k = 0; !usarCarriles && k < cantidad; k++) {
+            pool.enviar([&, k, inicio]() {
+                std::vector<Proceso*> procesos = generarCarga(opciones.carga, opciones.semilla,
+                                                              static_cast<uint64_t>(inicio + k));
+                PlanificadorMLFQ planificador;
+                planificador.setGuardarHistorial(false);    // Solo se usan los promedios
+                for (Proceso* proceso : procesos) {
+                    planificador.agregarProceso(proceso);
+                }
+                // Todas las configuraciones sobre la misma carga (comparación pareada)
+                for (size_t c = 0; c < numConfigs; c++) {
+                    planificador.configurarColas(configuraciones[c]);
+                    planificador.ejecutarSimulacion();
+                    muestras[k][c].wt = planificador.getPromedioWT();
+                    muestras[k][c].rt = planificador.getPromedioRT();
+                    muestras[k][c].tat = planificador.getPromedioTAT();
+                }
+                planificador.limpiarProcesos();
+            });
+        }
+        pool.esperar();
+
+        // Acumular en orden de réplica y evaluar el criterio cada PASO_EVALUACION
+        // réplicas: el punto de parada no depende del número de hilos
+        for (int k = 0; k < cantidad && !resultado.rankingResuelto; k++) {
+            for (size_t i = 0; i < numConfigs; i++) {
+                wt[i].agregar(muestras[k][i].wt);
+                rt[i].agregar(muestras[k][i].rt);
+                tat[i].agregar(muestras[k][i].tat);
+                for (size_t j = i + 1; j < numConfigs; j++) {
+                    diferencias[i][j].agregar(muestras[k][j].tat - muestras[k][i].tat);
+                }
+            }
+            resultado.replicas++;
+
+            if (resultado.replicas % PASO_EVALUACION == 0 || resultado.replicas == replicasMaximas) {
+                bool resuelto = evaluarRanking();
+                resultado.rankingResuelto = resuelto && resultado.replicas >= replicasMinimas;
+            }
+        }
+
+        if (resultado.rankingResuelto) {
+            break;
+        }
+    }
+
+    resultado.ranking.clear();
+    for (size_t r = 0; r < numConfigs; r++) {
+        size_t c = orden[r];
+        ResultadoConfiguracion configuracion;
+        configuracion.nombre = nombres[c];
+        configuracion.wt = wt[c].estimar(z);
+        configuracion.rt = rt[c].estimar(z);
+        configuracion.tat = tat[c].estimar(z);
+        resultado.ranking.push_back(configuracion);
+    }
+
+    return resultado;
+}
+
+/**
+ * Muestra el ranking con sus intervalos de confianza
+ */
+void MonteCarlo::mostrarResultado(const ResultadoMonteCarlo& resultado, double confianza) {
+    std::cout << "\n=== EVALUACIÓN MONTE CARLO ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Réplicas: " << resultado.replicas << "  Confianza: " << (confianza * 100.0) << "%  "
+              << (resultado.rankingResuelto ? "(ranking resuelto)" : "(tope de réplicas alcanzado)")
+              << std::endl;
+
+    std::cout << "\nConfiguración\tWT\t\tRT\t\tTAT" << std::endl;
+    std::cout << "------------------------------------------------------------" << std::endl;
+    for (const ResultadoConfiguracion& configuracion : resultado.ranking) {
+        std::cout << configuracion.nombre << "\t\t"
+                  << configuracion.wt.media << " ± " << configuracion.wt.semiancho << "\t"
+                  << configuracion.rt.media << " ± " << configuracion.rt.semiancho << "\t"
+                  << configuracion.tat.media << " ± " << configuracion.tat.semiancho << std::endl;
+    }
+
+    std::cout << "\nDiferencias pareadas de TAT:" << std::endl;
+    for (const ComparacionPareada& comparacion : resultado.comparaciones) {
+        std::cout << comparacion.peor << " - " << comparacion.mejor << ": "
+                  << comparacion.diferenciaTAT.media << " ± " << comparacion.diferenciaTAT.semiancho
+                  << (comparacion.resuelta ? "  (significativa)" : "  (no concluyente)") << std::endl;
+    }
+}
+
+/**
+ * Cuantil de la normal estándar con la aproximación racional de Acklam
+ * (error relativo menor a 1.2e-9)
+ */
+double MonteCarlo::cuantilNormal(double p) {
+    static const double a[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                               1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                               6.680131188771972e+01, -1.328068155288572e+01};
+    static const double c[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                               -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static const double d[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                               3.754408661907416e+00};
+
+    p = std::min(std::max(p, 1e-12), 1.0 - 1e-12);
+    const double bajo = 0.02425;
+
+    if (p < bajo) {
+        double q = std::sqrt(-2 * std::log(p));
+        return (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+    }
+    if (p > 1 - bajo) {
+        double q = std::sqrt(-2 * std::log(1 - p));
+        return -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+               ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+    }
+
+    double q = p - 0.5;
+    double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+}
@@ -0,0 +1,95 @@
+#ifndef MONTE_CARLO_H
+#define MONTE_CARLO_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "Proceso.h"
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Parámetros de la distribución de cargas de trabajo aleatorias
+ */
+struct ParametrosCarga {
+    int numProcesos;                // Procesos por carga
+    double mediaRafaga;             // Media de la ráfaga (exponencial, mínimo 1)
+    double mediaEntreLlegadas;      // Media del tiempo entre llegadas (exponencial, 0 = todos en t=0)
+    int nivelInicialMaximo;         // Nivel inicial uniforme en 1..nivelInicialMaximo
+
+    ParametrosCarga() : numProcesos(20), mediaRafaga(10.0), mediaEntreLlegadas(5.0),
+                        nivelInicialMaximo(1) {}
+};
+
+/**
+ * Opciones de la evaluación Monte Carlo
+ */
+struct OpcionesMonteCarlo {
+    ParametrosCarga carga;
+    std::string configuraciones;    // Letras de las configuraciones a comparar
+    int hilos;                      // 0 = todos los disponibles
+    int replicasMinimas;            // Réplicas antes de evaluar el criterio de parada
+    int replicasMaximas;            // Tope de réplicas
+    double confianza;               // Nivel de confianza de los intervalos (p. ej. 0.95)
+    uint64_t semilla;               // Semilla base; cada réplica deriva su propio flujo
+
+    OpcionesMonteCarlo() : configuraciones("ABC"), hilos(0), replicasMinimas(30),
+                           replicasMaximas(10000), confianza(0.95), semilla(12345) {}
+};
+
+/**
+ * Media e intervalo de confianza de una métrica
+ */
+struct EstimacionMetrica {
+    double media;
+    double semiancho;               // Intervalo: media ± semiancho
+};
+
+/**
+ * Resultado por configuración
+ */
+struct ResultadoConfiguracion {
+    std::string nombre;
+    EstimacionMetrica wt;
+    EstimacionMetrica rt;
+    EstimacionMetrica tat;
+};
+
+/**
+ * Diferencia pareada de TAT entre dos configuraciones consecutivas del ranking
+ */
+struct ComparacionPareada {
+    std::string mejor;
+    std::string peor;
+    EstimacionMetrica diferenciaTAT;    // TAT(peor) - TAT(mejor)
+    bool resuelta;                      // El intervalo no contiene 0
+};
+
+/**
+ * Resultado completo de la evaluación
+ */
+struct ResultadoMonteCarlo {
+    int replicas;
+    bool rankingResuelto;               // Se detuvo por criterio estadístico
+    std::vector<ResultadoConfiguracion> ranking;    // Ordenado por TAT medio
+    std::vector<ComparacionPareada> comparaciones;
+};
+
+/**
+ * Evaluación Monte Carlo de configuraciones MLFQ
+ *
+ * Genera cargas aleatorias en paralelo y ejecuta todas las configuraciones sobre
+ * la misma carga (comparación pareada). Se detiene cuando el orden por TAT medio
+ * de las configuraciones está resuelto estadísticamente o al llegar al tope.
+ */
+class MonteCarlo {
+public:
+    static ResultadoMonteCarlo ejecutar(const OpcionesMonteCarlo& opciones);
+    static std::vector<Proceso*> generarCarga(const ParametrosCarga& parametros,
+                                              uint64_t semilla, uint64_t replica);
+    static void mostrarResultado(const ResultadoMonteCarlo& resultado, double confianza);
+
+    // Cuantil de la normal estándar (aproximación de Acklam)
+    static double cuantilNormal(double probabilidad);
+};
+
+#endif // MONTE_CARLO_H
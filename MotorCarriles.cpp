@@ -0,0 +1,353 @@
+#include "MotorCarriles.h"
+#include <algorithm>
+#include <climits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MLFQ_CARRILES_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const int64_t LIBRE = INT64_MAX;    // Clave de un proceso que no es candidato (o no está en cola)
+const int BITS_NIVEL = 56;          // Clave: nivel en los bits altos, orden de llegada a la cola abajo
+
+/**
+ * Mínimo de la clave por carril y fila que lo alcanza (-1 si el carril no
+ * tiene procesos listos)
+ */
+void seleccionarEscalar(const int64_t (*clave)[MotorCarriles::CARRILES], int numFilas, int* elegido) {
+    int64_t minimo[MotorCarriles::CARRILES];
+    for (int c = 0; c < MotorCarriles::CARRILES; c++) {
+        minimo[c] = LIBRE;
+        elegido[c] = -1;
+    }
+    for (int fila = 0; fila < numFilas; fila++) {
+        for (int c = 0; c < MotorCarriles::CARRILES; c++) {
+            if (clave[fila][c] < minimo[c]) {
+                minimo[c] = clave[fila][c];
+                elegido[c] = fila;
+            }
+        }
+    }
+}
+
+#ifdef MLFQ_CARRILES_AVX2
+
+__attribute__((target("avx2")))
+void seleccionarAVX2(const int64_t (*clave)[MotorCarriles::CARRILES], int numFilas, int* elegido) {
+    const int REGISTROS = MotorCarriles::CARRILES / 4;
+    __m256i minimo[REGISTROS];
+    __m256i indice[REGISTROS];
+    for (int r = 0; r < REGISTROS; r++) {
+        minimo[r] = _mm256_set1_epi64x(LIBRE);
+        indice[r] = _mm256_set1_epi64x(-1);
+    }
+    for (int fila = 0; fila < numFilas; fila++) {
+        __m256i numeroFila = _mm256_set1_epi64x(fila);
+        for (int r = 0; r < REGISTROS; r++) {
+            __m256i valor = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&clave[fila][r * 4]));
+            __m256i menor = _mm256_cmpgt_epi64(minimo[r], valor);
+            minimo[r] = _mm256_blendv_epi8(minimo[r], valor, menor);
+            indice[r] = _mm256_blendv_epi8(indice[r], numeroFila, menor);
+        }
+    }
+    int64_t filas[MotorCarriles::CARRILES];
+    for (int r = 0; r < REGISTROS; r++) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&filas[r * 4]), indice[r]);
+    }
+    for (int c = 0; c < MotorCarriles::CARRILES; c++) {
+        elegido[c] = static_cast<int>(filas[c]);
+    }
+}
+
+#endif
+
+} // namespace
+
+MotorCarriles::MotorCarriles(const std::vector<ConfiguracionCola>& configuracionColas)
+    : configuracion(configuracionColas), numNiveles(static_cast<int>(configuracionColas.size())),
+      disponible(numNiveles > 0 && numNiveles <= MAX_NIVELES) {
+    int colasSJF = 0;
+    for (int i = 0; i < numNiveles && i < MAX_NIVELES; i++) {
+        roundRobin[i] = configuracion[i].algoritmo == TipoAlgoritmo::ROUND_ROBIN;
+        quantum[i] = configuracion[i].quantum;
+        colaOrdenada[i] = roundRobin[i] ? -1 : colasSJF++;
+    }
+    disponible = disponible && colasSJF <= MAX_COLAS_SJF;
+}
+
+bool MotorCarriles::admite(const std::vector<Proceso*>& procesos) {
+    if (procesos.empty() || procesos.size() > static_cast<size_t>(MAX_PROCESOS)) {
+        return false;
+    }
+    for (const Proceso* proceso : procesos) {
+        if (proceso->esMultirafaga()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Reparte las cargas en los carriles y avanza todos a la vez; un carril que
+ * termina toma la siguiente carga
+ */
+void MotorCarriles::simular(const std::vector<std::vector<Proceso*>>& cargas,
+                            std::vector<ResultadoCarga>& resultados) {
+    resultados.assign(cargas.size(), ResultadoCarga());
+    std::vector<size_t> escalares;
+    size_t proximaCarga = 0;
+
+    // Asigna al carril la siguiente carga que quepa; las demás van a la lista escalar
+    auto asignar = [&](int carril) {
+        carga[carril] = -1;
+        while (disponible && proximaCarga < cargas.size()) {
+            size_t indice = proximaCarga++;
+            if (cargarCarril(carril, cargas[indice])) {
+                carga[carril] = static_cast<long long>(indice);
+                return;
+            }
+            escalares.push_back(indice);
+        }
+    };
+
+    int activos = 0;
+    for (int c = 0; c < CARRILES; c++) {
+        asignar(c);
+        activos += carga[c] >= 0;
+    }
+
+    int elegido[CARRILES];
+    while (activos > 0) {
+        int numFilas = 0;
+        for (int c = 0; c < CARRILES; c++) {
+            if (carga[c] < 0) continue;
+
+            // Llegadas hasta el instante actual, en orden de llegada
+            while (siguiente[c] < numProcesos[c] && llegada[siguiente[c]][c] <= tiempo[c]) {
+                int fila = siguiente[c]++;
+                encolar(c, fila, nivel[fila][c]);
+            }
+            numFilas = std::max(numFilas, siguiente[c]);    // Las filas por admitir no son candidatas
+        }
+
+        seleccionar(numFilas, elegido);
+
+        for (int c = 0; c < CARRILES; c++) {
+            if (carga[c] < 0) continue;
+
+            if (elegido[c] >= 0) {
+                ejecutar(c, elegido[c]);
+            } else if (siguiente[c] < numProcesos[c]) {
+                // Sin procesos listos: saltar a la próxima llegada
+                tiempo[c] = std::max(tiempo[c] + 1, llegada[siguiente[c]][c]);
+            }
+            if (pendientes[c] > 0) {
+                continue;
+            }
+
+            size_t indice = static_cast<size_t>(carga[c]);
+            cerrarCarril(c, cargas[indice], resultados[indice]);
+            asignar(c);
+            activos -= carga[c] < 0;
+        }
+    }
+
+    // Si la configuración no cabe en los carriles, todo va por aquí
+    while (proximaCarga < cargas.size()) {
+        escalares.push_back(proximaCarga++);
+    }
+    for (size_t indice : escalares) {
+        simularEscalar(cargas[indice], resultados[indice]);
+    }
+}
+
+/**
+ * Copia la carga al carril en orden de llegada estable; los procesos de un
+ * nivel inexistente se descartan como en procesarLlegadas
+ */
+bool MotorCarriles::cargarCarril(int carril, const std::vector<Proceso*>& procesos) {
+    if (!admite(procesos)) {
+        return false;
+    }
+
+    int filas = 0;
+    for (size_t i = 0; i < procesos.size(); i++) {
+        const Proceso* proceso = procesos[i];
+        int nivelInicial = proceso->getQueueLevel() - 1;
+        if (nivelInicial < 0 || nivelInicial >= numNiveles) {
+            continue;
+        }
+
+        // Inserción estable por llegada (a lo sumo MAX_PROCESOS filas)
+        int fila = filas++;
+        while (fila > 0 && llegada[fila - 1][carril] > proceso->getArrivalTime()) {
+            llegada[fila][carril] = llegada[fila - 1][carril];
+            restante[fila][carril] = restante[fila - 1][carril];
+            nivel[fila][carril] = nivel[fila - 1][carril];
+            posicion[fila][carril] = posicion[fila - 1][carril];
+            fila--;
+        }
+        llegada[fila][carril] = proceso->getArrivalTime();
+        restante[fila][carril] = proceso->getBurstTime();
+        nivel[fila][carril] = nivelInicial;
+        posicion[fila][carril] = static_cast<int32_t>(i);
+    }
+
+    for (int fila = 0; fila < MAX_PROCESOS; fila++) {
+        clave[fila][carril] = LIBRE;
+        respuesta[fila][carril] = -1;
+        completado[fila][carril] = 0;
+    }
+    for (int i = 0; i < MAX_COLAS_SJF; i++) {
+        tamColaSJF[i][carril] = 0;
+    }
+    numProcesos[carril] = filas;
+    siguiente[carril] = 0;
+    pendientes[carril] = filas;
+    tiempo[carril] = 0;
+    secuencia[carril] = 0;
+    return true;
+}
+
+/**
+ * Pone el proceso en la cola del nivel. En Round Robin la clave es el orden
+ * de llegada a la cola; en SJF/STCF se repite Cola::agregarProceso (push_back
+ * y std::sort por CPU restante) sobre las filas y solo el primero queda como
+ * candidato.
+ */
+void MotorCarriles::encolar(int carril, int fila, int indiceNivel) {
+    int64_t base = static_cast<int64_t>(indiceNivel) << BITS_NIVEL;
+    nivel[fila][carril] = indiceNivel;
+    if (roundRobin[indiceNivel]) {
+        clave[fila][carril] = base | secuencia[carril]++;
+        return;
+    }
+
+    int32_t* cola = colaSJF[colaOrdenada[indiceNivel]][carril];
+    int32_t& tam = tamColaSJF[colaOrdenada[indiceNivel]][carril];
+    if (tam > 0) {
+        clave[cola[0]][carril] = LIBRE;
+    }
+    cola[tam++] = fila;
+    std::sort(cola, cola + tam, [this, carril](int32_t a, int32_t b) {
+        return restante[a][carril] < restante[b][carril];
+    });
+    clave[cola[0]][carril] = base;
+}
+
+/**
+ * Despacha el proceso: un quantum en Round Robin, toda la ráfaga en SJF/STCF.
+ * Si no termina baja un nivel (o vuelve al final de la última cola).
+ */
+void MotorCarriles::ejecutar(int carril, int fila) {
+    int indiceNivel = nivel[fila][carril];
+    clave[fila][carril] = LIBRE;
+    if (!roundRobin[indiceNivel]) {
+        // Cola::obtenerSiguienteProceso: sale el primero y el siguiente pasa a candidato
+        int32_t* cola = colaSJF[colaOrdenada[indiceNivel]][carril];
+        int32_t& tam = tamColaSJF[colaOrdenada[indiceNivel]][carril];
+        std::copy(cola + 1, cola + tam, cola);
+        if (--tam > 0) {
+            clave[cola[0]][carril] = static_cast<int64_t>(indiceNivel) << BITS_NIVEL;
+        }
+    }
+
+    if (respuesta[fila][carril] < 0) {
+        respuesta[fila][carril] = tiempo[carril] - llegada[fila][carril];
+    }
+
+    int tramo = restante[fila][carril];
+    if (roundRobin[indiceNivel]) {
+        tramo = std::min(quantum[indiceNivel], tramo);
+    }
+    restante[fila][carril] -= tramo;
+    tiempo[carril] += tramo;
+
+    if (restante[fila][carril] <= 0) {
+        completado[fila][carril] = tiempo[carril];
+        pendientes[carril]--;
+        return;
+    }
+    encolar(carril, fila, std::min(indiceNivel + 1, numNiveles - 1));
+}
+
+void MotorCarriles::seleccionar(int numFilas, int* elegido) const {
+#ifdef MLFQ_CARRILES_AVX2
+    if (KernelsMetricas::usaAVX2()) {
+        seleccionarAVX2(clave, numFilas, elegido);
+        return;
+    }
+#endif
+    seleccionarEscalar(clave, numFilas, elegido);
+}
+
+/**
+ * Devuelve los tiempos del carril a los procesos de la carga y libera el carril
+ */
+void MotorCarriles::cerrarCarril(int carril, const std::vector<Proceso*>& procesos, ResultadoCarga& resultado) {
+    for (Proceso* proceso : procesos) {
+        proceso->setCompletionTime(0);
+        proceso->setResponseTime(-1);
+        proceso->setTurnaroundTime(0);
+        proceso->setWaitingTime(0);
+    }
+    for (int fila = 0; fila < numProcesos[carril]; fila++) {
+        Proceso* proceso = procesos[posicion[fila][carril]];
+        proceso->setCompletionTime(completado[fila][carril]);
+        proceso->setResponseTime(respuesta[fila][carril]);
+    }
+    calcularResultado(procesos, resultado);
+}
+
+/**
+ * TAT/WT y promedios con los mismos kernels y sumas enteras que
+ * PlanificadorMLFQ::calcularMetricas
+ */
+void MotorCarriles::calcularResultado(const std::vector<Proceso*>& procesos, ResultadoCarga& resultado) {
+    size_t numProcesosCarga = procesos.size();
+    metricas.redimensionar(numProcesosCarga);
+    for (size_t i = 0; i < numProcesosCarga; i++) {
+        metricas.burst[i] = procesos[i]->getBurstTime() + procesos[i]->getTiempoES();
+        metricas.llegada[i] = procesos[i]->getArrivalTime();
+        metricas.completado[i] = procesos[i]->getCompletionTime();
+        metricas.respuesta[i] = procesos[i]->getResponseTime();
+    }
+    KernelsMetricas::calcularTiempos(metricas);
+    for (size_t i = 0; i < numProcesosCarga; i++) {
+        if (metricas.completado[i] > 0) {
+            procesos[i]->setTurnaroundTime(metricas.retorno[i]);
+            procesos[i]->setWaitingTime(metricas.espera[i]);
+        }
+    }
+
+    EstadisticasMetricas resumen = KernelsMetricas::calcularEstadisticas(metricas);
+    double n = static_cast<double>(numProcesosCarga);
+    resultado.promedioWT = static_cast<double>(resumen.wt.suma) / n;
+    resultado.promedioCT = static_cast<double>(resumen.ct.suma) / n;
+    resultado.promedioRT = static_cast<double>(resumen.rt.suma) / n;
+    resultado.promedioTAT = static_cast<double>(resumen.tat.suma) / n;
+}
+
+/**
+ * Cargas que no caben en un carril: simulación normal de PlanificadorMLFQ
+ * (los procesos siguen siendo del llamador)
+ */
+void MotorCarriles::simularEscalar(const std::vector<Proceso*>& procesos, ResultadoCarga& resultado) const {
+    resultado.escalar = true;
+    if (procesos.empty()) {
+        return;
+    }
+    PlanificadorMLFQ planificador;
+    planificador.setGuardarHistorial(false);
+    planificador.configurarColas(configuracion);
+    for (Proceso* proceso : procesos) {
+        planificador.agregarProceso(proceso);
+    }
+    planificador.ejecutarSimulacion();
+    resultado.promedioWT = planificador.getPromedioWT();
+    resultado.promedioCT = planificador.getPromedioCT();
+    resultado.promedioRT = planificador.getPromedioRT();
+    resultado.promedioTAT = planificador.getPromedioTAT();
+}
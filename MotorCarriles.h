@@ -0,0 +1,108 @@
+#ifndef MOTOR_CARRILES_H
+#define MOTOR_CARRILES_H
+
+#include <vector>
+#include <cstdint>
+#include "Proceso.h"
+#include "PlanificadorMLFQ.h"
+#include "KernelsMetricas.h"
+
+/**
+ * Promedios de una carga simulada por el motor de carriles
+ */
+struct ResultadoCarga {
+    double promedioWT;
+    double promedioCT;
+    double promedioRT;
+    double promedioTAT;
+    bool escalar;                   // Se simuló con PlanificadorMLFQ (no cabía en un carril)
+
+    ResultadoCarga() : promedioWT(0), promedioCT(0), promedioRT(0), promedioTAT(0), escalar(false) {}
+};
+
+/**
+ * Simulación por carriles de muchas cargas pequeñas con la misma configuración
+ *
+ * Cada carril SIMD lleva una carga independiente de hasta MAX_PROCESOS
+ * procesos con estado de tamaño fijo (filas por proceso, columnas por carril)
+ * y todos los carriles avanzan a la vez: en cada paso cada carril admite sus
+ * llegadas, elige el proceso de mayor prioridad y ejecuta un tramo. La
+ * elección es el mínimo de una clave de 64 bits por proceso (nivel y orden de
+ * llegada a la cola), que se calcula para CARRILES cargas con unas pocas
+ * instrucciones AVX2 por fila. En las colas SJF/STCF solo el primero tiene
+ * clave: el carril guarda la cola como un arreglo de filas y la ordena con el
+ * mismo std::sort y el mismo criterio que Cola, así que los empates quedan
+ * igual que en la simulación normal. Cuando un carril termina, toma la
+ * siguiente carga pendiente. No hay reservas de memoria por simulación, que
+ * en cargas de decenas de procesos cuestan más que planificar.
+ *
+ * Las métricas coinciden exactamente con PlanificadorMLFQ::ejecutarSimulacion
+ * sobre la misma carga. Las cargas con más de MAX_PROCESOS procesos o con E/S,
+ * y las configuraciones con más de MAX_NIVELES niveles o MAX_COLAS_SJF colas
+ * SJF/STCF, se simulan con PlanificadorMLFQ. El controlador de quantum y el
+ * modelo de costos no se usan aquí.
+ *
+ * Los procesos de cada carga solo reciben CT, RT, TAT y WT (el resto de su
+ * estado no cambia, salvo en las cargas simuladas con PlanificadorMLFQ).
+ */
+class MotorCarriles {
+public:
+    static const int CARRILES = 8;
+    static const int MAX_PROCESOS = 64;
+    static const int MAX_NIVELES = 64;
+    static const int MAX_COLAS_SJF = 4;
+
+private:
+    std::vector<ConfiguracionCola> configuracion;
+    int numNiveles;
+    bool disponible;                            // La configuración cabe en la clave de los carriles
+    bool roundRobin[MAX_NIVELES];
+    int quantum[MAX_NIVELES];
+    int colaOrdenada[MAX_NIVELES];              // Cola SJF/STCF del nivel (-1 en Round Robin)
+
+    // Estado por proceso (fila) y carril (columna); las filas siguen el orden de llegada
+    int64_t clave[MAX_PROCESOS][CARRILES];      // INT64_MAX: no está en ninguna cola
+    int32_t llegada[MAX_PROCESOS][CARRILES];
+    int32_t restante[MAX_PROCESOS][CARRILES];
+    int32_t nivel[MAX_PROCESOS][CARRILES];
+    int32_t respuesta[MAX_PROCESOS][CARRILES];
+    int32_t completado[MAX_PROCESOS][CARRILES];
+    int32_t posicion[MAX_PROCESOS][CARRILES];   // Índice del proceso en su carga
+
+    // Colas SJF/STCF por carril: filas en el orden del vector de Cola
+    int32_t colaSJF[MAX_COLAS_SJF][CARRILES][MAX_PROCESOS];
+    int32_t tamColaSJF[MAX_COLAS_SJF][CARRILES];
+
+    // Estado por carril
+    long long carga[CARRILES];                  // Carga asignada (-1: carril libre)
+    int numProcesos[CARRILES];
+    int siguiente[CARRILES];                    // Próxima fila por admitir
+    int pendientes[CARRILES];
+    int tiempo[CARRILES];
+    int64_t secuencia[CARRILES];                // Llegadas a cola Round Robin
+
+    ArreglosMetricas metricas;
+
+    bool cargarCarril(int carril, const std::vector<Proceso*>& procesos);
+    void encolar(int carril, int fila, int indiceNivel);
+    void ejecutar(int carril, int fila);
+    void seleccionar(int numFilas, int* elegido) const;
+    void cerrarCarril(int carril, const std::vector<Proceso*>& procesos, ResultadoCarga& resultado);
+    void calcularResultado(const std::vector<Proceso*>& procesos, ResultadoCarga& resultado);
+    void simularEscalar(const std::vector<Proceso*>& procesos, ResultadoCarga& resultado) const;
+
+public:
+    explicit MotorCarriles(const std::vector<ConfiguracionCola>& configuracionColas);
+
+    /**
+     * La carga puede ir en un carril (tamaño y una sola ráfaga de CPU)
+     */
+    static bool admite(const std::vector<Proceso*>& procesos);
+
+    /**
+     * Simula cada carga y devuelve sus promedios en el mismo orden
+     */
+    void simular(const std::vector<std::vector<Proceso*>>& cargas, std::vector<ResultadoCarga>& resultados);
+};
+
+#endif // MOTOR_CARRILES_H
@@ -0,0 +1,308 @@
+#ifndef MOTOR_FIJO_H
+#define MOTOR_FIJO_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "mlfq_api.h"
+
+/**
+ * Motor MLFQ de capacidad fija para cargas pequeñas, sin memoria dinámica
+ *
+ * Las capacidades (trabajos y niveles) son parámetros de la plantilla y todo
+ * el estado vive en el propio objeto, que el llamador pone en la pila o en un
+ * bloque suyo: ninguna simulación reserva memoria. Los trabajos son índices en
+ * arreglos fijos, las colas Round Robin son anillos y las SJF/STCF arreglos
+ * ordenados con el mismo push_back + std::sort que Cola, así que los empates
+ * quedan igual. El estado que cambia durante la simulación está junto en un
+ * bloque trivialmente copiable: cargar() guarda su valor inicial y reiniciar()
+ * lo restaura con un solo memcpy. configurar() conserva la carga si sus niveles
+ * siguen existiendo, así que la misma carga se compara con varias
+ * configuraciones (configurar, reiniciar, ejecutar) sin volver a validarla ni
+ * ordenar las llegadas.
+ *
+ * Acepta los tipos de mlfq_api.h y da las mismas métricas que
+ * PlanificadorMLFQ con los mismos niveles (una ráfaga de CPU por trabajo, sin
+ * controlador de quantum ni modelo de costos, historial sin fusionar). No
+ * guarda el historial: resumen.numIntervalos cuenta los despachos.
+ *
+ * Uso típico: MotorFijo<> motor; motor.configurar(niveles, 4);
+ * motor.simular(trabajos, n, metricas, &resumen);
+ */
+template <int MAX_TRABAJOS = 256, int MAX_NIVELES = 8>
+class MotorFijo {
+    static_assert(MAX_TRABAJOS > 0, "MotorFijo necesita capacidad para al menos un trabajo");
+    static_assert(MAX_NIVELES > 0 && MAX_NIVELES <= 64, "MotorFijo admite de 1 a 64 niveles");
+
+private:
+    /**
+     * Estado mutable de una simulación (se copia entero al reiniciar)
+     */
+    struct Estado {
+        int tiempo;
+        int siguiente;                      // Próximo trabajo por llegar, en orden de llegada
+        int pendientes;
+        int despachos;
+        uint64_t nivelesOcupados;           // Bit i: la cola del nivel i tiene trabajos
+        int inicio[MAX_NIVELES];            // Primer elemento del anillo (Round Robin)
+        int tam[MAX_NIVELES];
+        int32_t restante[MAX_TRABAJOS];
+        int32_t nivel[MAX_TRABAJOS];
+        int32_t respuesta[MAX_TRABAJOS];    // -1: no ha ejecutado
+        int32_t completado[MAX_TRABAJOS];
+    };
+    static_assert(std::is_trivially_copyable<Estado>::value, "Estado debe copiarse con memcpy");
+
+    // Configuración
+    int numNiveles;
+    bool roundRobin[MAX_NIVELES];
+    int quantum[MAX_NIVELES];
+
+    // Carga (no cambia al simular)
+    int numTrabajos;
+    int nivelMaximo;                        // Nivel inicial más bajo de la carga (1..numNiveles)
+    int32_t llegada[MAX_TRABAJOS];
+    int32_t rafaga[MAX_TRABAJOS];
+    int32_t ordenLlegada[MAX_TRABAJOS];     // Índices de trabajo, estable por llegada
+
+    Estado estado;
+    Estado inicial;
+
+    // Contenido de las colas; solo cuenta lo que indican inicio y tam del estado
+    int32_t colas[MAX_NIVELES][MAX_TRABAJOS];
+
+    void encolar(int indiceNivel, int trabajo) {
+        estado.nivel[trabajo] = indiceNivel;
+        int32_t* cola = colas[indiceNivel];
+        int& tam = estado.tam[indiceNivel];
+        if (roundRobin[indiceNivel]) {
+            cola[(estado.inicio[indiceNivel] + tam) % MAX_TRABAJOS] = trabajo;
+            tam++;
+        } else {
+            // Cola::agregarProceso: push_back y std::sort por CPU restante
+            cola[tam++] = trabajo;
+            const int32_t* restante = estado.restante;
+            std::sort(cola, cola + tam, [restante](int32_t a, int32_t b) {
+                return restante[a] < restante[b];
+            });
+        }
+        estado.nivelesOcupados |= uint64_t(1) << indiceNivel;
+    }
+
+    int desencolar(int indiceNivel) {
+        int32_t* cola = colas[indiceNivel];
+        int& tam = estado.tam[indiceNivel];
+        int trabajo;
+        if (roundRobin[indiceNivel]) {
+            int& inicio = estado.inicio[indiceNivel];
+            trabajo = cola[inicio];
+            inicio = (inicio + 1) % MAX_TRABAJOS;
+        } else {
+            trabajo = cola[0];
+            std::copy(cola + 1, cola + tam, cola);
+        }
+        if (--tam == 0) {
+            estado.nivelesOcupados &= ~(uint64_t(1) << indiceNivel);
+        }
+        return trabajo;
+    }
+
+    /**
+     * Un despacho: quantum en Round Robin, toda la ráfaga en SJF/STCF; si no
+     * termina baja un nivel (o vuelve al final de la última cola)
+     */
+    void despachar(int indiceNivel) {
+        int trabajo = desencolar(indiceNivel);
+        if (estado.respuesta[trabajo] < 0) {
+            estado.respuesta[trabajo] = estado.tiempo - llegada[trabajo];
+        }
+
+        int tramo = estado.restante[trabajo];
+        if (roundRobin[indiceNivel]) {
+            tramo = std::min(quantum[indiceNivel], tramo);
+        }
+        estado.restante[trabajo] -= tramo;
+        estado.tiempo += tramo;
+        estado.despachos++;
+
+        if (estado.restante[trabajo] <= 0) {
+            estado.completado[trabajo] = estado.tiempo;
+            estado.pendientes--;
+        } else {
+            encolar(std::min(indiceNivel + 1, numNiveles - 1), trabajo);
+        }
+    }
+
+public:
+    static const int CAPACIDAD_TRABAJOS = MAX_TRABAJOS;
+    static const int CAPACIDAD_NIVELES = MAX_NIVELES;
+
+    MotorFijo() : numNiveles(0), numTrabajos(0), nivelMaximo(0) {
+        std::memset(&inicial, 0, sizeof(Estado));
+        reiniciar();
+    }
+
+    /**
+     * Niveles de mayor a menor prioridad
+     * @return MLFQ_OK, MLFQ_ERROR_ARGUMENTOS (sin niveles o más de MAX_NIVELES)
+     *         o MLFQ_ERROR_NIVEL
+     */
+    int configurar(const mlfq_nivel* niveles, int cantidad) {
+        if (niveles == nullptr || cantidad <= 0 || cantidad > MAX_NIVELES) {
+            return MLFQ_ERROR_ARGUMENTOS;
+        }
+        for (int i = 0; i < cantidad; i++) {
+            int algoritmo = niveles[i].algoritmo;
+            if ((algoritmo != MLFQ_RR && algoritmo != MLFQ_SJF && algoritmo != MLFQ_STCF) ||
+                (algoritmo == MLFQ_RR && niveles[i].quantum <= 0)) {
+                return MLFQ_ERROR_NIVEL;
+            }
+        }
+        for (int i = 0; i < cantidad; i++) {
+            roundRobin[i] = niveles[i].algoritmo == MLFQ_RR;
+            quantum[i] = std::max(1, niveles[i].quantum);
+        }
+        numNiveles = cantidad;
+        if (nivelMaximo > numNiveles) {
+            // La carga tiene trabajos en niveles que ya no existen
+            numTrabajos = 0;
+            nivelMaximo = 0;
+            std::memset(&inicial, 0, sizeof(Estado));
+            reiniciar();
+        }
+        return MLFQ_OK;
+    }
+
+    /**
+     * Copia la carga, ordena las llegadas y deja listo el estado inicial
+     * @return MLFQ_OK, MLFQ_ERROR_ARGUMENTOS (sin configurar, vacía o más de
+     *         MAX_TRABAJOS) o MLFQ_ERROR_TRABAJO (mismas reglas que mlfq_ejecutar)
+     */
+    int cargar(const mlfq_trabajo* trabajos, int cantidad) {
+        if (numNiveles == 0 || trabajos == nullptr || cantidad <= 0 || cantidad > MAX_TRABAJOS) {
+            return MLFQ_ERROR_ARGUMENTOS;
+        }
+        for (int i = 0; i < cantidad; i++) {
+            const mlfq_trabajo& trabajo = trabajos[i];
+            if (trabajo.burstTime <= 0 || trabajo.arrivalTime < 0 || trabajo.priority <= 0 ||
+                trabajo.queueLevel <= 0 || trabajo.queueLevel > numNiveles) {
+                return MLFQ_ERROR_TRABAJO;
+            }
+        }
+
+        numTrabajos = cantidad;
+        nivelMaximo = 0;
+        inicial.tiempo = 0;
+        inicial.siguiente = 0;
+        inicial.pendientes = cantidad;
+        inicial.despachos = 0;
+        inicial.nivelesOcupados = 0;
+        for (int i = 0; i < MAX_NIVELES; i++) {
+            inicial.inicio[i] = 0;
+            inicial.tam[i] = 0;
+        }
+        for (int i = 0; i < cantidad; i++) {
+            llegada[i] = trabajos[i].arrivalTime;
+            rafaga[i] = trabajos[i].burstTime;
+            inicial.restante[i] = trabajos[i].burstTime;
+            inicial.nivel[i] = trabajos[i].queueLevel - 1;
+            nivelMaximo = std::max(nivelMaximo, trabajos[i].queueLevel);
+            inicial.respuesta[i] = -1;
+            inicial.completado[i] = 0;
+
+            // Inserción estable: los empates de llegada siguen el orden de entrada
+            int posicion = i;
+            while (posicion > 0 && llegada[ordenLlegada[posicion - 1]] > llegada[i]) {
+                ordenLlegada[posicion] = ordenLlegada[posicion - 1];
+                posicion--;
+            }
+            ordenLlegada[posicion] = i;
+        }
+        reiniciar();
+        return MLFQ_OK;
+    }
+
+    /**
+     * Vuelve al estado recién cargado (un memcpy); sin carga no hace nada
+     */
+    void reiniciar() {
+        std::memcpy(&estado, &inicial, sizeof(Estado));
+    }
+
+    /**
+     * Simula la carga desde el estado actual hasta que todos terminan
+     */
+    void ejecutar() {
+        while (estado.pendientes > 0) {
+            // Llegadas hasta el instante actual
+            while (estado.siguiente < numTrabajos && llegada[ordenLlegada[estado.siguiente]] <= estado.tiempo) {
+                int trabajo = ordenLlegada[estado.siguiente++];
+                encolar(estado.nivel[trabajo], trabajo);
+            }
+
+            if (estado.nivelesOcupados == 0) {
+                // CPU ociosa: saltar a la próxima llegada
+                estado.tiempo = std::max(estado.tiempo + 1, llegada[ordenLlegada[estado.siguiente]]);
+                continue;
+            }
+            despachar(__builtin_ctzll(estado.nivelesOcupados));
+        }
+    }
+
+    /**
+     * Métricas de la última ejecución, en el orden de la carga (cualquiera de
+     * los dos buffers puede ser NULL)
+     */
+    void obtenerMetricas(mlfq_metricas_trabajo* metricas, mlfq_resumen* resumen) const {
+        long long sumaWT = 0, sumaCT = 0, sumaRT = 0, sumaTAT = 0;
+        int makespan = 0;
+        for (int i = 0; i < numTrabajos; i++) {
+            int ct = estado.completado[i];
+            int tat = ct > 0 ? ct - llegada[i] : 0;
+            int wt = ct > 0 ? tat - rafaga[i] : 0;
+            int rt = estado.respuesta[i];
+            sumaWT += wt;
+            sumaCT += ct;
+            sumaRT += rt;
+            sumaTAT += tat;
+            makespan = std::max(makespan, ct);
+            if (metricas != nullptr) {
+                metricas[i].waitingTime = wt;
+                metricas[i].completionTime = ct;
+                metricas[i].responseTime = rt;
+                metricas[i].turnaroundTime = tat;
+            }
+        }
+
+        if (resumen != nullptr) {
+            // Sumas enteras divididas al final, igual que PlanificadorMLFQ::calcularMetricas
+            double n = static_cast<double>(numTrabajos);
+            resumen->promedioWT = static_cast<double>(sumaWT) / n;
+            resumen->promedioCT = static_cast<double>(sumaCT) / n;
+            resumen->promedioRT = static_cast<double>(sumaRT) / n;
+            resumen->promedioTAT = static_cast<double>(sumaTAT) / n;
+            resumen->makespan = makespan;
+            resumen->numIntervalos = estado.despachos;
+        }
+    }
+
+    /**
+     * cargar + ejecutar + obtenerMetricas, con los códigos de mlfq_ejecutar
+     */
+    int simular(const mlfq_trabajo* trabajos, int cantidad,
+                mlfq_metricas_trabajo* metricas, mlfq_resumen* resumen) {
+        int codigo = cargar(trabajos, cantidad);
+        if (codigo != MLFQ_OK) {
+            return codigo;
+        }
+        ejecutar();
+        obtenerMetricas(metricas, resumen);
+        return MLFQ_OK;
+    }
+
+    int getNumTrabajos() const { return numTrabajos; }
+    int getNumNiveles() const { return numNiveles; }
+};
+
+#endif // MOTOR_FIJO_H
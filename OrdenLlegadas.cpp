@@ -0,0 +1,90 @@
+#include "OrdenLlegadas.h"
+#include <cstdint>
+
+namespace {
+
+const size_t UMBRAL_INSERCION = 64;     // Por debajo, inserción directa (también estable)
+
+struct ClaveOrden {
+    uint32_t clave;
+    uint32_t origen;
+};
+
+/**
+ * Clave sin signo que conserva el orden de los enteros con signo
+ */
+inline uint32_t claveLlegada(const Proceso* proceso) {
+    return static_cast<uint32_t>(proceso->getArrivalTime()) ^ 0x80000000u;
+}
+
+} // namespace
+
+/**
+ * Ordena por llegada de forma estable
+ */
+void OrdenLlegadas::ordenarEstable(std::vector<Proceso*>& procesos, std::vector<size_t>* indices) {
+    size_t n = procesos.size();
+    if (n < 2) return;
+
+    if (n < UMBRAL_INSERCION) {
+        for (size_t i = 1; i < n; i++) {
+            Proceso* proceso = procesos[i];
+            size_t indice = indices != nullptr ? (*indices)[i] : 0;
+            int llegada = proceso->getArrivalTime();
+            size_t j = i;
+            while (j > 0 && procesos[j - 1]->getArrivalTime() > llegada) {
+                procesos[j] = procesos[j - 1];
+                if (indices != nullptr) (*indices)[j] = (*indices)[j - 1];
+                j--;
+            }
+            procesos[j] = proceso;
+            if (indices != nullptr) (*indices)[j] = indice;
+        }
+        return;
+    }
+
+    std::vector<ClaveOrden> claves(n);
+    std::vector<ClaveOrden> auxiliar(n);
+    size_t conteos[4][256] = {};
+    for (size_t i = 0; i < n; i++) {
+        uint32_t clave = claveLlegada(procesos[i]);
+        claves[i].clave = clave;
+        claves[i].origen = static_cast<uint32_t>(i);
+        for (int d = 0; d < 4; d++) {
+            conteos[d][(clave >> (8 * d)) & 0xFF]++;
+        }
+    }
+
+    // Una pasada estable por dígito, del menos al más significativo
+    for (int d = 0; d < 4; d++) {
+        size_t* conteo = conteos[d];
+        if (conteo[(claves[0].clave >> (8 * d)) & 0xFF] == n) {
+            continue;   // Todas las claves comparten este dígito
+        }
+
+        size_t posicion = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t cantidad = conteo[b];
+            conteo[b] = posicion;
+            posicion += cantidad;
+        }
+        for (size_t i = 0; i < n; i++) {
+            auxiliar[conteo[(claves[i].clave >> (8 * d)) & 0xFF]++] = claves[i];
+        }
+        claves.swap(auxiliar);
+    }
+
+    std::vector<Proceso*> ordenados(n);
+    for (size_t i = 0; i < n; i++) {
+        ordenados[i] = procesos[claves[i].origen];
+    }
+    procesos.swap(ordenados);
+
+    if (indices != nullptr) {
+        std::vector<size_t> indicesOrdenados(n);
+        for (size_t i = 0; i < n; i++) {
+            indicesOrdenados[i] = (*indices)[claves[i].origen];
+        }
+        indices->swap(indicesOrdenados);
+    }
+}
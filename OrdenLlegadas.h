@@ -0,0 +1,23 @@
+#ifndef ORDEN_LLEGADAS_H
+#define ORDEN_LLEGADAS_H
+
+#include <vector>
+#include <cstddef>
+#include "Proceso.h"
+
+/**
+ * Ordenamiento estable de procesos por tiempo de llegada
+ */
+class OrdenLlegadas {
+public:
+    /**
+     * Radix sort LSD por tiempo de llegada (dígitos de 8 bits, se omiten las
+     * pasadas en que todas las claves comparten el dígito). Estable: los
+     * empates conservan el orden original.
+     * @param procesos: procesos a ordenar
+     * @param indices: si no es nulo, se permuta igual que procesos
+     */
+    static void ordenarEstable(std::vector<Proceso*>& procesos, std::vector<size_t>* indices = nullptr);
+};
+
+#endif // ORDEN_LLEGADAS_H
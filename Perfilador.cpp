@@ -0,0 +1,307 @@
+#include "Perfilador.h"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <mutex>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+std::atomic<bool> Perfilador::habilitado(false);
+
+namespace {
+
+const int NUM_FASES = static_cast<int>(FasePerfil::CANTIDAD);
+const char* const NOMBRES_CONTADORES[Perfilador::NUM_CONTADORES] = {"ciclos", "instrucciones", "fallos_cache"};
+
+struct AcumuladorFase {
+    std::atomic<uint64_t> llamadas;
+    std::atomic<uint64_t> nanosegundos;
+    std::atomic<uint64_t> valores[Perfilador::NUM_CONTADORES];
+};
+
+AcumuladorFase acumuladores[NUM_FASES];
+std::atomic<bool> contadorDisponible[Perfilador::NUM_CONTADORES];
+
+std::mutex mutexMotivo;
+std::string motivoSinContadores;    // Primer error al abrir un contador
+std::string archivoJSON;
+
+void registrarMotivo(const char* contador, int error) {
+    std::lock_guard<std::mutex> lock(mutexMotivo);
+    if (!motivoSinContadores.empty()) return;
+
+    motivoSinContadores = std::string(contador) + ": " + std::strerror(error);
+    if (error == EACCES || error == EPERM) {
+        std::ifstream paranoid("/proc/sys/kernel/perf_event_paranoid");
+        int nivel;
+        if (paranoid >> nivel) {
+            motivoSinContadores += " (perf_event_paranoid=" + std::to_string(nivel) + ")";
+        }
+    } else if (error == ENOENT || error == EOPNOTSUPP) {
+        motivoSinContadores += " (el procesador o la máquina virtual no expone el evento)";
+    }
+}
+
+/**
+ * Contadores de hardware del hilo, leídos en grupo con una sola llamada
+ */
+class GrupoContadores {
+private:
+    int descriptores[Perfilador::NUM_CONTADORES];
+    int posicion[Perfilador::NUM_CONTADORES];  // Posición del valor en la lectura del grupo (-1 = no abierto)
+    int lider;
+    int abiertos;
+
+public:
+    GrupoContadores() : lider(-1), abiertos(0) {
+        for (int i = 0; i < Perfilador::NUM_CONTADORES; i++) {
+            descriptores[i] = -1;
+            posicion[i] = -1;
+        }
+#ifdef __linux__
+        const uint64_t eventos[Perfilador::NUM_CONTADORES] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES
+        };
+        for (int i = 0; i < Perfilador::NUM_CONTADORES; i++) {
+            struct perf_event_attr atributos;
+            std::memset(&atributos, 0, sizeof(atributos));
+            atributos.type = PERF_TYPE_HARDWARE;
+            atributos.size = sizeof(atributos);
+            atributos.config = eventos[i];
+            atributos.disabled = (lider < 0) ? 1 : 0;
+            atributos.exclude_kernel = 1;
+            atributos.exclude_hv = 1;
+            atributos.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                                    PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            int descriptor = static_cast<int>(syscall(__NR_perf_event_open, &atributos, 0, -1, lider, 0));
+            if (descriptor < 0) {
+                registrarMotivo(NOMBRES_CONTADORES[i], errno);
+                continue;
+            }
+            if (lider < 0) {
+                lider = descriptor;
+            }
+            descriptores[i] = descriptor;
+            posicion[i] = abiertos++;
+            contadorDisponible[i] = true;
+        }
+        if (lider >= 0) {
+            ioctl(lider, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(lider, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#else
+        {
+            std::lock_guard<std::mutex> lock(mutexMotivo);
+            if (motivoSinContadores.empty()) {
+                motivoSinContadores = "perf_event_open solo está disponible en Linux";
+            }
+        }
+#endif
+    }
+
+    ~GrupoContadores() {
+#ifdef __linux__
+        for (int descriptor : descriptores) {
+            if (descriptor >= 0) close(descriptor);
+        }
+#endif
+    }
+
+    GrupoContadores(const GrupoContadores&) = delete;
+    GrupoContadores& operator=(const GrupoContadores&) = delete;
+
+    /**
+     * Valores acumulados del hilo; si el núcleo multiplexó los contadores se
+     * extrapolan al tiempo habilitado
+     */
+    void leer(uint64_t valores[]) const {
+        for (int i = 0; i < Perfilador::NUM_CONTADORES; i++) {
+            valores[i] = 0;
+        }
+#ifdef __linux__
+        if (lider < 0) return;
+
+        uint64_t datos[3 + Perfilador::NUM_CONTADORES];
+        if (read(lider, datos, sizeof(datos)) < static_cast<ssize_t>((3 + abiertos) * sizeof(uint64_t))) {
+            return;
+        }
+        uint64_t habilitadoNs = datos[1];
+        uint64_t ejecutandoNs = datos[2];
+        for (int i = 0; i < Perfilador::NUM_CONTADORES; i++) {
+            if (posicion[i] < 0) continue;
+            uint64_t valor = datos[3 + posicion[i]];
+            if (ejecutandoNs > 0 && ejecutandoNs < habilitadoNs) {
+                valor = static_cast<uint64_t>(static_cast<double>(valor) * habilitadoNs / ejecutandoNs);
+            }
+            valores[i] = valor;
+        }
+#endif
+    }
+};
+
+const GrupoContadores& grupoDelHilo() {
+    thread_local GrupoContadores grupo;
+    return grupo;
+}
+
+bool hayContadores() {
+    for (int i = 0; i < Perfilador::NUM_CONTADORES; i++) {
+        if (contadorDisponible[i]) return true;
+    }
+    return false;
+}
+
+void emitirAlSalir() {
+    Perfilador::mostrarResumen(std::cerr);
+    if (!archivoJSON.empty() && Perfilador::escribirJSON(archivoJSON)) {
+        std::cerr << "Perfil escrito en: " << archivoJSON << std::endl;
+    }
+}
+
+} // namespace
+
+void Perfilador::activar(const std::string& nombreArchivoJSON) {
+    bool yaActivo = habilitado.exchange(true);
+    if (!nombreArchivoJSON.empty()) {
+        archivoJSON = nombreArchivoJSON;
+    }
+    if (!yaActivo) {
+        std::atexit(emitirAlSalir);
+    }
+}
+
+void Perfilador::leer(LecturaContadores& lectura) {
+    grupoDelHilo().leer(lectura.valores);
+    lectura.nanosegundos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Perfilador::acumular(FasePerfil fase, const LecturaContadores& inicio, const LecturaContadores& fin) {
+    AcumuladorFase& acumulador = acumuladores[static_cast<int>(fase)];
+    acumulador.llamadas.fetch_add(1, std::memory_order_relaxed);
+    acumulador.nanosegundos.fetch_add(fin.nanosegundos - inicio.nanosegundos, std::memory_order_relaxed);
+    for (int i = 0; i < NUM_CONTADORES; i++) {
+        acumulador.valores[i].fetch_add(fin.valores[i] - inicio.valores[i], std::memory_order_relaxed);
+    }
+}
+
+const char* Perfilador::nombreFase(FasePerfil fase) {
+    switch (fase) {
+        case FasePerfil::LECTURA:              return "lectura";
+        case FasePerfil::SIMULACION:           return "simulacion";
+        case FasePerfil::LLEGADAS:             return "  llegadas";
+        case FasePerfil::SELECCION:            return "  seleccion";
+        case FasePerfil::EJECUCION:            return "  ejecucion";
+        case FasePerfil::ESCRITURA_RESULTADOS: return "escritura_resultados";
+        case FasePerfil::ESCRITURA_DETALLE:    return "escritura_detalle";
+        default:                               return "?";
+    }
+}
+
+/**
+ * Tabla por fase: llamadas, tiempo y contadores (IPC = instrucciones / ciclos)
+ */
+void Perfilador::mostrarResumen(std::ostream& salida) {
+    salida << "\n=== PERFIL POR FASES ===" << std::endl;
+    salida << std::left << std::setw(22) << "Fase" << std::right
+           << std::setw(10) << "Llamadas" << std::setw(13) << "Tiempo(ms)"
+           << std::setw(16) << "Ciclos" << std::setw(16) << "Instrucciones"
+           << std::setw(7) << "IPC" << std::setw(14) << "Fallos_cache" << std::endl;
+
+    for (int f = 0; f < NUM_FASES; f++) {
+        const AcumuladorFase& acumulador = acumuladores[f];
+        uint64_t llamadas = acumulador.llamadas;
+        if (llamadas == 0) continue;
+
+        uint64_t ciclos = acumulador.valores[0];
+        uint64_t instrucciones = acumulador.valores[1];
+        salida << std::left << std::setw(22) << nombreFase(static_cast<FasePerfil>(f)) << std::right
+               << std::setw(10) << llamadas
+               << std::setw(13) << std::fixed << std::setprecision(2) << acumulador.nanosegundos / 1e6;
+        for (int i = 0; i < NUM_CONTADORES; i++) {
+            if (i == 2) {
+                if (contadorDisponible[0] && contadorDisponible[1] && ciclos > 0) {
+                    salida << std::setw(7) << std::setprecision(2)
+                           << static_cast<double>(instrucciones) / static_cast<double>(ciclos);
+                } else {
+                    salida << std::setw(7) << "-";
+                }
+            }
+            int ancho = (i == 2) ? 14 : 16;
+            if (contadorDisponible[i]) {
+                salida << std::setw(ancho) << acumulador.valores[i].load();
+            } else {
+                salida << std::setw(ancho) << "-";
+            }
+        }
+        salida << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(mutexMotivo);
+    if (!hayContadores()) {
+        salida << "Contadores de hardware no disponibles ("
+               << (motivoSinContadores.empty() ? "sin mediciones" : motivoSinContadores)
+               << "); solo se midió el tiempo." << std::endl;
+    } else if (!motivoSinContadores.empty()) {
+        salida << "Algunos contadores no están disponibles (" << motivoSinContadores << ")." << std::endl;
+    }
+    salida << "Las fases con sangría forman parte de simulacion." << std::endl;
+}
+
+bool Perfilador::escribirJSON(const std::string& nombreArchivo) {
+    std::ofstream archivo(nombreArchivo);
+    if (!archivo.is_open()) {
+        std::cerr << "Error: No se pudo crear el archivo " << nombreArchivo << std::endl;
+        return false;
+    }
+
+    std::string motivo;
+    {
+        std::lock_guard<std::mutex> lock(mutexMotivo);
+        for (char caracter : motivoSinContadores) {
+            if (caracter == '"' || caracter == '\\') motivo += '\\';
+            motivo += caracter;
+        }
+    }
+
+    archivo << "{\n";
+    archivo << "  \"contadores_hardware\": " << (hayContadores() ? "true" : "false") << ",\n";
+    archivo << "  \"motivo\": \"" << motivo << "\",\n";
+    archivo << "  \"fases\": [";
+    bool primera = true;
+    for (int f = 0; f < NUM_FASES; f++) {
+        const AcumuladorFase& acumulador = acumuladores[f];
+        if (acumulador.llamadas == 0) continue;
+
+        // Sin la sangría usada en la tabla
+        std::string nombre = nombreFase(static_cast<FasePerfil>(f));
+        nombre.erase(0, nombre.find_first_not_of(' '));
+
+        archivo << (primera ? "\n" : ",\n");
+        primera = false;
+        archivo << "    {\"fase\": \"" << nombre << "\", "
+                << "\"llamadas\": " << acumulador.llamadas.load() << ", "
+                << "\"tiempo_ns\": " << acumulador.nanosegundos.load();
+        for (int i = 0; i < NUM_CONTADORES; i++) {
+            archivo << ", \"" << NOMBRES_CONTADORES[i] << "\": ";
+            if (contadorDisponible[i]) {
+                archivo << acumulador.valores[i].load();
+            } else {
+                archivo << "null";
+            }
+        }
+        archivo << "}";
+    }
+    archivo << "\n  ]\n}\n";
+    return static_cast<bool>(archivo);
+}
@@ -0,0 +1,97 @@
+#ifndef PERFILADOR_H
+#define PERFILADOR_H
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Fases medidas por el perfilador. SIMULACION incluye a LLEGADAS, SELECCION y
+ * EJECUCION (los pasos del bucle principal).
+ */
+enum class FasePerfil {
+    LECTURA,                // ArchivoUtils::leerArchivoProcesos
+    SIMULACION,             // PlanificadorMLFQ::ejecutarSimulacion
+    LLEGADAS,               // Despertares de E/S y procesarLlegadas
+    SELECCION,              // seleccionarProcesoParaEjecutar
+    EJECUCION,              // ejecutarProceso
+    ESCRITURA_RESULTADOS,   // _ConfigX.txt
+    ESCRITURA_DETALLE,      // _ConfigX_detalle.txt
+    CANTIDAD
+};
+
+/**
+ * Valores de los contadores en un instante
+ */
+struct LecturaContadores {
+    uint64_t nanosegundos;
+    uint64_t valores[3];    // Ciclos, instrucciones y fallos de caché
+};
+
+/**
+ * Perfilado por fases con tiempo de reloj y contadores de hardware
+ *
+ * Cada hilo abre su propio grupo de contadores con perf_event_open (ciclos,
+ * instrucciones y fallos de caché, solo en modo usuario) la primera vez que
+ * mide. Si el núcleo no lo permite (perf_event_paranoid, contenedores, otros
+ * sistemas) se mide solo el tiempo y el resumen indica el motivo. Desactivado,
+ * cada punto de medición cuesta una lectura atómica.
+ *
+ * Las mediciones de todos los hilos se suman, así en modo por lotes el tiempo
+ * de una fase puede superar el tiempo total de la ejecución.
+ */
+class Perfilador {
+private:
+    static std::atomic<bool> habilitado;
+
+public:
+    static const int NUM_CONTADORES = 3;
+
+    /**
+     * Activa las mediciones y registra la salida del resumen al terminar el programa
+     * @param archivoJSON: además del resumen en consola, se escribe en este archivo (vacío = no)
+     */
+    static void activar(const std::string& archivoJSON = "");
+
+    static bool activo() {
+        return habilitado.load(std::memory_order_relaxed);
+    }
+
+    static void leer(LecturaContadores& lectura);
+    static void acumular(FasePerfil fase, const LecturaContadores& inicio, const LecturaContadores& fin);
+
+    static void mostrarResumen(std::ostream& salida);
+    static bool escribirJSON(const std::string& nombreArchivo);
+    static const char* nombreFase(FasePerfil fase);
+};
+
+/**
+ * Mide el alcance en que vive y lo suma a una fase
+ */
+class MedicionFase {
+private:
+    FasePerfil fase;
+    bool midiendo;
+    LecturaContadores inicio;
+
+public:
+    explicit MedicionFase(FasePerfil fase) : fase(fase), midiendo(Perfilador::activo()) {
+        if (midiendo) {
+            Perfilador::leer(inicio);
+        }
+    }
+
+    ~MedicionFase() {
+        if (midiendo) {
+            LecturaContadores fin;
+            Perfilador::leer(fin);
+            Perfilador::acumular(fase, inicio, fin);
+        }
+    }
+
+    MedicionFase(const MedicionFase&) = delete;
+    MedicionFase& operator=(const MedicionFase&) = delete;
+};
+
+#endif // PERFILADOR_H
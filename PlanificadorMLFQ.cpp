@@ -1,14 +1,25 @@
 #include "PlanificadorMLFQ.h"
+#include "OrdenLlegadas.h"
+#include "Perfilador.h"
 #include <iostream>
 #include <algorithm>
 #include <iomanip>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <thread>
+#include <atomic>
+#include <unordered_map>
 
 /**
  * Constructor del PlanificadorMLFQ
  */
 PlanificadorMLFQ::PlanificadorMLFQ(bool debug) 
-    : tiempoActual(0), modoDebug(debug), promedioWT(0), promedioCT(0), 
-      promedioRT(0), promedioTAT(0) {
+    : procesosConESPendiente(0), tiempoActual(0), modoDebug(debug), fusionarHistorial(false), ultimoProcesoRegistrado(nullptr),
+      fuenteLlegadas(nullptr), observador(nullptr), guardarHistorial(true), controladorQuantum(nullptr),
+      promedioWT(0), promedioCT(0), promedioRT(0), promedioTAT(0),
+      anchoCubetaHistograma(1), numCubetasHistograma(0) {
+    estadisticas.n = 0;
 }
 
 /**
@@ -19,6 +30,7 @@ PlanificadorMLFQ::~PlanificadorMLFQ() {
         delete cola;
     }
     colas.clear();
+    delete controladorQuantum;
 }
 
 /**
@@ -30,12 +42,19 @@ void PlanificadorMLFQ::configurarColas(const std::vector<ConfiguracionCola>& con
         delete cola;
     }
     colas.clear();
+    configuracion = configuraciones;
+    if (configuracion.size() > static_cast<size_t>(MapaNiveles::MAX_NIVELES)) {
+        std::cerr << "Advertencia: Se usan solo los primeros " << MapaNiveles::MAX_NIVELES
+                  << " niveles de " << configuracion.size() << std::endl;
+        configuracion.erase(configuracion.begin() + MapaNiveles::MAX_NIVELES, configuracion.end());
+    }
     
     // Crear nuevas colas
-    for (const auto& config : configuraciones) {
+    for (const auto& config : configuracion) {
         Cola* nuevaCola = new Cola(config.nivel, config.algoritmo, config.quantum);
         colas.push_back(nuevaCola);
     }
+    nivelesOcupados.reiniciar(static_cast<int>(colas.size()));
     
     if (modoDebug) {
         std::cout << "Configuración de colas:" << std::endl;
@@ -65,67 +84,260 @@ void PlanificadorMLFQ::limpiarProcesos() {
     procesos.clear();
     
     // Limpiar también las colas
-    for (Cola* cola : colas) {
-        cola->limpiar();
-    }
+    vaciarColas();
     
     // Limpiar otros contenedores
     while (!procesosLlegada.empty()) {
         procesosLlegada.pop();
     }
+    bloqueados.reiniciar();
     historialEjecucion.clear();
+    ultimoProcesoRegistrado = nullptr;
 }
 
 /**
  * Ejecuta la simulación completa del MLFQ
  */
 void PlanificadorMLFQ::ejecutarSimulacion() {
-    if (procesos.empty() || colas.empty()) {
+    if ((procesos.empty() && fuenteLlegadas == nullptr) || colas.empty()) {
         std::cout << "Error: No hay procesos o colas configuradas." << std::endl;
         return;
     }
     
-    // Reiniciar estado
+    MedicionFase medicion(FasePerfil::SIMULACION);
+    iniciarSimulacion();
+    continuarSimulacion();
+}
+
+/**
+ * Solo se particiona si cada periodo ocupado es independiente del anterior: el
+ * controlador de quantum y el modelo de costos arrastran estado entre periodos,
+ * la E/S deja la CPU ociosa con trabajo pendiente y el observador y la fuente
+ * esperan los eventos en orden.
+ */
+bool PlanificadorMLFQ::admiteParticiones() const {
+    if (controladorQuantum != nullptr || modeloCostos.activo() || modoDebug ||
+        observador != nullptr || fuenteLlegadas != nullptr || colas.empty()) {
+        return false;
+    }
+    for (const Proceso* proceso : procesos) {
+        if (proceso->esMultirafaga()) return false;
+    }
+    return true;
+}
+
+/**
+ * Simula en paralelo los periodos ocupados de la carga, con el mismo resultado
+ * que ejecutarSimulacion.
+ *
+ * La CPU nunca está ociosa con procesos listos, así que sin E/S los periodos
+ * ocupados dependen solo de las llegadas y las ráfagas, no del orden en que se
+ * atienden: recorriendo las llegadas, un periodo termina en
+ * max(fin, llegada) + ráfaga y el siguiente empieza con la primera llegada
+ * posterior a ese fin (en el mismo instante todavía pueden quedar procesos de
+ * ráfaga 0 en las colas). Al terminar un periodo las colas quedan vacías y nada de
+ * lo que queda en el planificador afecta al siguiente, de modo que ese límite es
+ * una anticipación (lookahead) exacta: los periodos se agrupan en particiones de
+ * trabajo parecido, cada hilo simula las suyas en un planificador propio con la
+ * misma configuración y al final los historiales se concatenan en orden y las
+ * métricas se calculan sobre todos los procesos.
+ *
+ * Si la simulación no admite particiones o hay un solo periodo, simula en
+ * secuencia.
+ */
+int PlanificadorMLFQ::ejecutarSimulacionParalela(int hilos) {
+    if (hilos < 2 || procesos.empty() || !admiteParticiones()) {
+        ejecutarSimulacion();
+        return 1;
+    }
+    
+    MedicionFase medicion(FasePerfil::SIMULACION);
     reiniciarSimulacion();
+    OrdenLlegadas::ordenarEstable(procesos);
     
-    // Ordenar procesos por tiempo de llegada
-    std::sort(procesos.begin(), procesos.end(),
-              [](const Proceso* a, const Proceso* b) {
-                  return a->getArrivalTime() < b->getArrivalTime();
-              });
+    // Inicio (índice en procesos) y trabajo de cada periodo ocupado
+    std::vector<size_t> inicios;
+    std::vector<long long> trabajos;
+    long long fin = 0;
+    long long total = 0;
+    int niveles = static_cast<int>(colas.size());
+    for (size_t i = 0; i < procesos.size(); i++) {
+        const Proceso* proceso = procesos[i];
+        if (inicios.empty() || proceso->getArrivalTime() > fin) {
+            inicios.push_back(i);
+            trabajos.push_back(0);
+            fin = proceso->getArrivalTime();
+        }
+        // Los procesos con un nivel inexistente nunca se encolan
+        if (proceso->getQueueLevel() >= 1 && proceso->getQueueLevel() <= niveles) {
+            fin = std::max(fin, static_cast<long long>(proceso->getArrivalTime())) + proceso->getBurstTime();
+            trabajos.back() += proceso->getBurstTime();
+            total += proceso->getBurstTime();
+        }
+    }
     
-    // Colocar procesos en cola de llegada
-    for (Proceso* proceso : procesos) {
-        procesosLlegada.push(proceso);
+    // Varias particiones por hilo para repartir bien periodos de tamaños distintos
+    size_t particionesDeseadas = static_cast<size_t>(hilos) * 4;
+    long long trabajoPorParticion = std::max(1LL, total / static_cast<long long>(particionesDeseadas));
+    std::vector<size_t> cortes;
+    long long acumulado = 0;
+    for (size_t p = 0; p < inicios.size(); p++) {
+        if (cortes.empty() || acumulado >= trabajoPorParticion) {
+            cortes.push_back(inicios[p]);
+            acumulado = 0;
+        }
+        acumulado += trabajos[p];
+    }
+    cortes.push_back(procesos.size());
+    
+    size_t numParticiones = cortes.size() - 1;
+    if (numParticiones < 2) {
+        ejecutarSimulacion();
+        return 1;
+    }
+    
+    std::vector<PlanificadorMLFQ*> particiones(numParticiones);
+    for (size_t p = 0; p < numParticiones; p++) {
+        PlanificadorMLFQ* particion = new PlanificadorMLFQ();
+        particion->configurarColas(configuracion);
+        particion->fusionarHistorial = fusionarHistorial;
+        particion->guardarHistorial = guardarHistorial;
+        particion->procesos.assign(procesos.begin() + cortes[p], procesos.begin() + cortes[p + 1]);
+        particiones[p] = particion;
+    }
+    
+    // Cada proceso pertenece a una sola partición: los hilos no comparten estado
+    std::atomic<size_t> siguiente(0);
+    auto trabajar = [&particiones, &siguiente, numParticiones]() {
+        for (size_t p = siguiente++; p < numParticiones; p = siguiente++) {
+            particiones[p]->iniciarSimulacion();
+            particiones[p]->continuarSimulacion();
+        }
+    };
+    size_t numHilos = std::min(static_cast<size_t>(hilos), numParticiones);
+    std::vector<std::thread> trabajadores;
+    for (size_t h = 1; h < numHilos; h++) {
+        trabajadores.emplace_back(trabajar);
+    }
+    trabajar();
+    for (std::thread& trabajador : trabajadores) {
+        trabajador.join();
+    }
+    
+    size_t registros = 0;
+    for (const PlanificadorMLFQ* particion : particiones) {
+        registros += particion->historialEjecucion.size();
+    }
+    historialEjecucion.reserve(registros);
+    for (PlanificadorMLFQ* particion : particiones) {
+        historialEjecucion.insert(historialEjecucion.end(), particion->historialEjecucion.begin(),
+                                  particion->historialEjecucion.end());
+        sobrecarga.tiempoUtil += particion->sobrecarga.tiempoUtil;
+        tiempoActual = std::max(tiempoActual, particion->tiempoActual);
+        particion->procesos.clear();    // Los procesos son de este planificador
+        delete particion;
+    }
+    if (!guardarHistorial && historialEjecucion.size() > 1) {
+        historialEjecucion.erase(historialEjecucion.begin(), historialEjecucion.end() - 1);
+    }
+    ultimoProcesoRegistrado = nullptr;
+    
+    calcularMetricas();
+    return static_cast<int>(numParticiones);
+}
+
+/**
+ * Reinicia el estado y coloca los procesos en la cola de llegada
+ */
+void PlanificadorMLFQ::iniciarSimulacion() {
+    // Reiniciar estado
+    reiniciarSimulacion();
+    
+    if (fuenteLlegadas != nullptr) {
+        // Los procesos se piden a la fuente a medida que se necesitan
+        solicitarLlegada();
+    } else {
+        // Ordenar procesos por tiempo de llegada (estable: los empates siguen el orden de entrada)
+        OrdenLlegadas::ordenarEstable(procesos);
+        
+        // Colocar procesos en cola de llegada
+        for (Proceso* proceso : procesos) {
+            procesosLlegada.push(proceso);
+        }
     }
     
     if (modoDebug) {
         std::cout << "\n=== INICIANDO SIMULACIÓN MLFQ ===" << std::endl;
     }
+}
+
+/**
+ * Ejecuta una iteración del bucle principal de simulación
+ */
+void PlanificadorMLFQ::avanzarPaso() {
+    if (modoDebug) {
+        std::cout << "\n--- Tiempo " << tiempoActual << " ---" << std::endl;
+    }
     
-    // Bucle principal de simulación
-    while (!procesosLlegada.empty() || !todasColasVacias()) {
-        if (modoDebug) {
-            std::cout << "\n--- Tiempo " << tiempoActual << " ---" << std::endl;
-        }
+    {
+        MedicionFase medicion(FasePerfil::LLEGADAS);
+        
+        // Procesos cuya E/S terminó (antes que las llegadas del mismo instante)
+        procesarDespertares();
         
         // Procesar llegadas de procesos
         procesarLlegadas();
-        
-        // Seleccionar proceso para ejecutar
-        Proceso* procesoActual = seleccionarProcesoParaEjecutar();
-        
-        if (procesoActual != nullptr) {
-            // Ejecutar proceso
-            ejecutarProceso(procesoActual);
-        } else {
-            // No hay procesos listos, avanzar tiempo
-            tiempoActual++;
-        }
-        
-        if (modoDebug) {
-            mostrarEstadoColas();
+    }
+    
+    // Seleccionar proceso para ejecutar
+    Proceso* procesoActual;
+    {
+        MedicionFase medicion(FasePerfil::SELECCION);
+        procesoActual = seleccionarProcesoParaEjecutar();
+    }
+    
+    if (procesoActual != nullptr) {
+        // Ejecutar proceso
+        MedicionFase medicion(FasePerfil::EJECUCION);
+        ejecutarProceso(procesoActual);
+    } else if (!procesosLlegada.empty() || !bloqueados.vacia()) {
+        // No hay procesos listos: saltar directamente a la próxima llegada o despertar
+        tiempoActual = std::max(tiempoActual + 1, proximoEvento());
+    } else {
+        tiempoActual++;
+    }
+    
+    if (modoDebug) {
+        mostrarEstadoColas();
+    }
+}
+
+/**
+ * Avanza la simulación mientras el reloj no alcance el límite indicado.
+ * El último intervalo puede terminar después del límite (no se interrumpe un quantum).
+ */
+void PlanificadorMLFQ::ejecutarHasta(int tiempoLimite) {
+    while (!simulacionTerminada() && tiempoActual < tiempoLimite) {
+        avanzarPaso();
+    }
+}
+
+/**
+ * Avanza hasta que no queden procesos y calcula las métricas finales
+ */
+void PlanificadorMLFQ::continuarSimulacion() {
+    // Bucle principal de simulación
+    while (!simulacionTerminada()) {
+        if (rondasFinalesResolubles()) {
+            resolverRondasFinales();
+            break;
         }
+        avanzarPaso();
+    }
+    
+    // El último registro ya no puede crecer
+    if (observador != nullptr && !historialEjecucion.empty()) {
+        observador->registroCerrado(historialEjecucion.back());
     }
     
     // Calcular métricas finales
@@ -134,6 +346,61 @@ void PlanificadorMLFQ::ejecutarSimulacion() {
     if (modoDebug) {
         std::cout << "\n=== SIMULACIÓN COMPLETADA ===" << std::endl;
         mostrarResultados();
+        std::cout << "Rango WT: [" << estadisticas.wt.minimo << ", " << estadisticas.wt.maximo << "]"
+                  << "  RT: [" << estadisticas.rt.minimo << ", " << estadisticas.rt.maximo << "]"
+                  << "  TAT: [" << estadisticas.tat.minimo << ", " << estadisticas.tat.maximo << "]"
+                  << std::endl;
+    }
+}
+
+bool PlanificadorMLFQ::simulacionTerminada() const {
+    return procesosLlegada.empty() && bloqueados.vacia() && todasColasVacias();
+}
+
+/**
+ * Devuelve a la cola de su nivel actual los procesos cuya E/S terminó. Al
+ * ceder la CPU antes de agotar el quantum conservan su prioridad.
+ */
+void PlanificadorMLFQ::procesarDespertares() {
+    if (bloqueados.vacia()) return;
+    
+    despertados.clear();
+    bloqueados.avanzarHasta(tiempoActual, despertados);
+    for (Proceso* proceso : despertados) {
+        encolar(proceso->getCurrentQueueLevel() - 1, proceso);
+        
+        if (modoDebug) {
+            std::cout << "Proceso " << proceso->getEtiqueta()
+                      << " termina E/S y vuelve a cola " << proceso->getCurrentQueueLevel() << std::endl;
+        }
+    }
+}
+
+/**
+ * Tiempo de la próxima llegada o despertar (-1 si no queda ninguno)
+ */
+int PlanificadorMLFQ::proximoEvento() const {
+    int proximo = bloqueados.proximoVencimiento();
+    if (!procesosLlegada.empty()) {
+        int llegada = procesosLlegada.front()->getArrivalTime();
+        proximo = (proximo < 0) ? llegada : std::min(proximo, llegada);
+    }
+    return proximo;
+}
+
+/**
+ * Programa el despertar de un proceso que terminó su ráfaga de CPU
+ */
+void PlanificadorMLFQ::bloquearProceso(Proceso* proceso) {
+    int duracion = proceso->iniciarES();
+    bloqueados.programar(proceso, tiempoActual + duracion);
+    if (proceso->getRafagaCPURestante() == proceso->getBurstTimeRestante()) {
+        procesosConESPendiente--;   // Empezó su última ráfaga de CPU
+    }
+    
+    if (modoDebug) {
+        std::cout << "Proceso " << proceso->getEtiqueta() << " se bloquea en E/S hasta "
+                  << (tiempoActual + duracion) << std::endl;
     }
 }
 
@@ -146,11 +413,17 @@ void PlanificadorMLFQ::procesarLlegadas() {
         
         Proceso* proceso = procesosLlegada.front();
         procesosLlegada.pop();
+        if (procesosLlegada.empty()) {
+            solicitarLlegada();
+        }
         
         // Agregar proceso a su cola inicial
         int nivelInicial = proceso->getQueueLevel() - 1; // Convertir a índice (0-based)
         if (nivelInicial >= 0 && nivelInicial < static_cast<int>(colas.size())) {
-            colas[nivelInicial]->agregarProceso(proceso);
+            encolar(nivelInicial, proceso);
+            if (proceso->getRafagaCPURestante() < proceso->getBurstTimeRestante()) {
+                procesosConESPendiente++;
+            }
             
             if (modoDebug) {
                 std::cout << "Proceso " << proceso->getEtiqueta() 
@@ -161,15 +434,41 @@ void PlanificadorMLFQ::procesarLlegadas() {
 }
 
 /**
- * Selecciona el próximo proceso a ejecutar (cola de mayor prioridad)
+ * Agrega un proceso a una cola y la marca como no vacía
  */
-Proceso* PlanificadorMLFQ::seleccionarProcesoParaEjecutar() {
+void PlanificadorMLFQ::encolar(int indiceNivel, Proceso* proceso) {
+    colas[indiceNivel]->agregarProceso(proceso);
+    nivelesOcupados.marcar(indiceNivel);
+    avisarProfundidad(indiceNivel);
+}
+
+void PlanificadorMLFQ::avisarProfundidad(int indiceNivel) {
+    if (observador != nullptr) {
+        observador->profundidadCola(tiempoActual, indiceNivel + 1, static_cast<int>(colas[indiceNivel]->size()));
+    }
+}
+
+void PlanificadorMLFQ::vaciarColas() {
     for (Cola* cola : colas) {
-        if (!cola->isEmpty()) {
-            return cola->obtenerSiguienteProceso();
-        }
+        cola->limpiar();
     }
-    return nullptr;
+    nivelesOcupados.limpiar();
+}
+
+/**
+ * Selecciona el próximo proceso a ejecutar (primera cola no vacía del mapa)
+ */
+Proceso* PlanificadorMLFQ::seleccionarProcesoParaEjecutar() {
+    int nivel = nivelesOcupados.primero();
+    if (nivel < 0) {
+        return nullptr;
+    }
+    Proceso* proceso = colas[nivel]->obtenerSiguienteProceso();
+    if (colas[nivel]->isEmpty()) {
+        nivelesOcupados.desmarcar(nivel);
+    }
+    avisarProfundidad(nivel);
+    return proceso;
 }
 
 /**
@@ -178,30 +477,43 @@ Proceso* PlanificadorMLFQ::seleccionarProcesoParaEjecutar() {
 void PlanificadorMLFQ::ejecutarProceso(Proceso* proceso) {
     if (proceso == nullptr) return;
     
+    // Cambio de contexto y recarga de caché antes de que el proceso avance
+    if (modeloCostos.activo()) {
+        aplicarCostoDespacho(proceso);
+    }
+    
     // Establecer tiempo de respuesta si es la primera vez que se ejecuta
     if (!proceso->getHasStarted()) {
         proceso->setResponseTime(tiempoActual - proceso->getArrivalTime());
+        if (controladorQuantum != nullptr) {
+            controladorQuantum->registrarRespuesta(tiempoActual - proceso->getArrivalTime());
+        }
     }
     
-    Cola* colaActual = colas[proceso->getCurrentQueueLevel() - 1];
+    int indiceNivel = proceso->getCurrentQueueLevel() - 1;
+    Cola* colaActual = colas[indiceNivel];
     int tiempoEjecucion = 0;
     int tiempoInicio = tiempoActual;
+    bool bloqueado = false;
     
     if (colaActual->getAlgoritmo() == TipoAlgoritmo::ROUND_ROBIN) {
-        // Round Robin: ejecutar por quantum o hasta completar
-        tiempoEjecucion = std::min(colaActual->getQuantum(), proceso->getBurstTimeRestante());
+        // Round Robin: ejecutar por quantum o hasta completar; si el proceso es el
+        // único ejecutable en la última cola, encadenar quantums hasta el próximo evento
+        tiempoEjecucion = calcularTiempoSinInterrupcion(proceso, colaActual);
         proceso->ejecutar(tiempoEjecucion);
         tiempoActual += tiempoEjecucion;
         
         if (proceso->getIsCompleted()) {
             // Proceso completado
-            proceso->setCompletionTime(tiempoActual);
-            proceso->calcularTiempos();
+            completarProceso(proceso);
             
             if (modoDebug) {
                 std::cout << "Proceso " << proceso->getEtiqueta() 
                           << " COMPLETADO en tiempo " << tiempoActual << std::endl;
             }
+        } else if (proceso->rafagaCPUTerminada()) {
+            // Cedió la CPU para hacer E/S antes de agotar el quantum: no se degrada
+            bloqueado = true;
         } else {
             // Proceso no completado, mover a siguiente cola
             moverProcesoASiguienteCola(proceso);
@@ -214,13 +526,16 @@ void PlanificadorMLFQ::ejecutarProceso(Proceso* proceso) {
         }
         
     } else {
-        // SJF/STCF: ejecutar hasta completar
-        tiempoEjecucion = proceso->getBurstTimeRestante();
+        // SJF/STCF: ejecutar hasta completar la ráfaga de CPU
+        tiempoEjecucion = proceso->getRafagaCPURestante();
         proceso->ejecutar(tiempoEjecucion);
         tiempoActual += tiempoEjecucion;
         
-        proceso->setCompletionTime(tiempoActual);
-        proceso->calcularTiempos();
+        if (proceso->getIsCompleted()) {
+            completarProceso(proceso);
+        } else {
+            bloqueado = true;
+        }
         
         if (modoDebug) {
             std::cout << "Proceso " << proceso->getEtiqueta() 
@@ -236,7 +551,290 @@ void PlanificadorMLFQ::ejecutarProceso(Proceso* proceso) {
     registro.tiempoFin = tiempoActual;
     registro.nivelCola = proceso->getCurrentQueueLevel();
     registro.algoritmo = colaActual->obtenerNombreAlgoritmo();
+    registrarEjecucion(proceso, registro);
+    proceso->setUltimaEjecucion(tiempoActual);
+    sobrecarga.tiempoUtil += tiempoEjecucion;
+    
+    // La E/S empieza cuando el intervalo ya quedó registrado
+    if (bloqueado) {
+        bloquearProceso(proceso);
+    }
+    
+    // El controlador decide después de registrar el intervalo con el quantum usado
+    if (controladorQuantum != nullptr && colaActual->getAlgoritmo() == TipoAlgoritmo::ROUND_ROBIN) {
+        controladorQuantum->registrarQuantum(indiceNivel, !proceso->getIsCompleted() && !bloqueado);
+        CambioQuantum cambio;
+        if (controladorQuantum->ajustar(indiceNivel, *colaActual, tiempoActual, cambio)) {
+            historialQuantum.push_back(cambio);
+            if (modoDebug) {
+                std::cout << "Quantum de cola " << cambio.nivel << ": " << cambio.quantumAnterior
+                          << " -> " << cambio.quantumNuevo << " (RT ventana " << cambio.rtVentana
+                          << ", agotados " << cambio.tasaDegradacion << ")" << std::endl;
+            }
+        }
+    }
+}
+
+/**
+ * Tiempo que un proceso de Round Robin ejecuta antes de volver a planificarse.
+ * Normalmente es un quantum; con el historial fusionado, si el proceso está solo
+ * en la última cola se ejecutan de una vez todos los quantums que terminan antes
+ * del próximo evento, llegada o fin de E/S (hasta el primer límite de quantum en
+ * o después de él), que es exactamente lo que haría la simulación quantum a quantum.
+ */
+int PlanificadorMLFQ::calcularTiempoSinInterrupcion(const Proceso* proceso, const Cola* cola) const {
+    int quantum = cola->getQuantum();
+    int restante = proceso->getRafagaCPURestante();
+    
+    bool ultimaCola = (cola == colas.back());
+    if (!fusionarHistorial || modoDebug || controladorQuantum != nullptr || !ultimaCola || restante <= quantum || !todasColasVacias()) {
+        return std::min(quantum, restante);
+    }
+    
+    int evento = proximoEvento();
+    if (evento < 0) {
+        return restante;
+    }
+    
+    long long hastaLlegada = static_cast<long long>(evento) - tiempoActual;
+    long long quantums = std::max(1LL, (hastaLlegada + quantum - 1) / quantum);
+    return static_cast<int>(std::min(static_cast<long long>(restante), quantums * quantum));
+}
+
+/**
+ * Estado estacionario final: no quedan llegadas ni E/S pendientes y todos los
+ * procesos listos están en la última cola, que es Round Robin. Desde ahí cada
+ * proceso recibe un quantum por ronda hasta terminar y el orden de la cola no
+ * cambia, así que los tiempos de completado se calculan sin simular.
+ * El controlador de quantum, el modelo de costos y la depuración necesitan ver
+ * cada despacho y desactivan el atajo.
+ */
+bool PlanificadorMLFQ::rondasFinalesResolubles() const {
+    int ultimoNivel = static_cast<int>(colas.size()) - 1;
+    return ultimoNivel >= 0 && procesosLlegada.empty() && bloqueados.vacia() && procesosConESPendiente == 0 &&
+           !modoDebug && controladorQuantum == nullptr && !modeloCostos.activo() &&
+           nivelesOcupados.primero() == ultimoNivel &&
+           colas[ultimoNivel]->getAlgoritmo() == TipoAlgoritmo::ROUND_ROBIN;
+}
+
+/**
+ * Termina las rondas de Round Robin de la última cola en O(n log n).
+ *
+ * Con k_i = ceil(r_i / Q) quantums para el proceso i, antes de su último
+ * quantum terminaron los procesos con menos rondas (todo su restante) y cada
+ * proceso con al menos k_i rondas ejecutó k_i - 1 quantums. En la ronda k_i
+ * ejecutan antes que i los procesos que lo preceden en la cola: un quantum
+ * completo los que tienen más rondas y su último tramo los que tienen las
+ * mismas. Agrupando por k_i, el primer término son sumas prefijas y el conteo
+ * de precedentes con más rondas se lleva en un árbol de Fenwick por posición.
+ *
+ * El historial, si alguien lo usa, se genera ronda por ronda con los mismos
+ * registros (y fusiones) que la simulación quantum a quantum.
+ */
+void PlanificadorMLFQ::resolverRondasFinales() {
+    int ultimoNivel = static_cast<int>(colas.size()) - 1;
+    Cola* cola = colas[ultimoNivel];
+    std::vector<Proceso*> orden = cola->obtenerTodosProcesos();
+    cola->limpiar();
+    nivelesOcupados.desmarcar(ultimoNivel);
+    
+    const long long quantum = cola->getQuantum();
+    const long long inicio = tiempoActual;
+    const size_t n = orden.size();
+    
+    std::vector<long long> restante(n);
+    std::vector<long long> rondas(n);
+    std::vector<size_t> porRondas(n);
+    long long total = 0;
+    for (size_t i = 0; i < n; i++) {
+        restante[i] = orden[i]->getBurstTimeRestante();
+        rondas[i] = std::max(1LL, (restante[i] + quantum - 1) / quantum);
+        porRondas[i] = i;
+        total += restante[i];
+    }
+    std::sort(porRondas.begin(), porRondas.end(), [&rondas](size_t a, size_t b) {
+        return rondas[a] != rondas[b] ? rondas[a] < rondas[b] : a < b;
+    });
+    
+    // Trabajo total de los procesos con menos rondas que cada grupo
+    std::vector<long long> terminadoAntes(n);
+    long long acumulado = 0;
+    for (size_t g = 0; g < n; ) {
+        size_t fin = g;
+        while (fin < n && rondas[porRondas[fin]] == rondas[porRondas[g]]) fin++;
+        for (size_t j = g; j < fin; j++) terminadoAntes[j] = acumulado;
+        for (size_t j = g; j < fin; j++) acumulado += restante[porRondas[j]];
+        g = fin;
+    }
+    
+    // Grupos de mayor a menor cantidad de rondas; el árbol tiene a los de más rondas
+    std::vector<int> fenwick(n + 1, 0);
+    std::vector<long long> completado(n);
+    for (size_t fin = n; fin > 0; ) {
+        size_t g = fin;
+        while (g > 0 && rondas[porRondas[g - 1]] == rondas[porRondas[fin - 1]]) g--;
+        
+        long long vivos = static_cast<long long>(n - g);
+        long long tramosMismoGrupo = 0;     // Dentro del grupo porRondas sigue el orden de la cola
+        for (size_t j = g; j < fin; j++) {
+            size_t i = porRondas[j];
+            long long precedentesConMas = 0;
+            for (size_t p = i; p > 0; p -= p & (~p + 1)) precedentesConMas += fenwick[p];
+            long long ultimoTramo = restante[i] - (rondas[i] - 1) * quantum;
+            completado[i] = inicio + terminadoAntes[j] + (rondas[i] - 1) * quantum * vivos +
+                            precedentesConMas * quantum + tramosMismoGrupo + ultimoTramo;
+            tramosMismoGrupo += ultimoTramo;
+        }
+        for (size_t j = g; j < fin; j++) {
+            for (size_t p = porRondas[j] + 1; p <= n; p += p & (~p + 1)) fenwick[p]++;
+        }
+        fin = g;
+    }
+    
+    // Tiempo de respuesta de los que nunca ejecutaron: primera ronda en orden de cola
+    long long primeraRonda = inicio;
+    for (size_t i = 0; i < n; i++) {
+        if (!orden[i]->getHasStarted()) {
+            orden[i]->setResponseTime(static_cast<int>(primeraRonda - orden[i]->getArrivalTime()));
+        }
+        primeraRonda += std::min(quantum, restante[i]);
+    }
+    
+    if (guardarHistorial || observador != nullptr) {
+        std::string algoritmo = cola->obtenerNombreAlgoritmo();
+        std::vector<size_t> vivos(n);
+        for (size_t i = 0; i < n; i++) vivos[i] = i;
+        std::vector<long long> pendiente = restante;
+        long long reloj = inicio;
+        while (!vivos.empty()) {
+            size_t quedan = 0;
+            for (size_t v = 0; v < vivos.size(); v++) {
+                size_t i = vivos[v];
+                // Solo en la cola, con la fusión activa, la simulación ejecuta todo de una vez
+                bool solo = fusionarHistorial && vivos.size() - v == 1 && quedan == 0;
+                long long tramo = solo ? pendiente[i] : std::min(quantum, pendiente[i]);
+                RegistroEjecucion registro;
+                registro.etiquetaProceso = orden[i]->getEtiqueta();
+                registro.tiempoInicio = static_cast<int>(reloj);
+                registro.tiempoFin = static_cast<int>(reloj + tramo);
+                registro.nivelCola = ultimoNivel + 1;
+                registro.algoritmo = algoritmo;
+                registrarEjecucion(orden[i], registro);
+                reloj += tramo;
+                pendiente[i] -= tramo;
+                if (pendiente[i] > 0) vivos[quedan++] = i;
+            }
+            vivos.resize(quedan);
+        }
+    }
+    
+    // Completados en orden de tiempo, como los entregaría la simulación
+    std::vector<size_t> porCompletado(n);
+    for (size_t i = 0; i < n; i++) porCompletado[i] = i;
+    std::sort(porCompletado.begin(), porCompletado.end(), [&completado](size_t a, size_t b) {
+        return completado[a] < completado[b];
+    });
+    // Mientras tanto, en la cola esperan todos los vivos menos el que ejecuta
+    if (observador != nullptr) {
+        observador->profundidadCola(static_cast<int>(inicio), ultimoNivel + 1, static_cast<int>(n) - 1);
+    }
+    size_t vivos = n;
+    for (size_t i : porCompletado) {
+        Proceso* proceso = orden[i];
+        proceso->ejecutar(static_cast<int>(restante[i]));
+        tiempoActual = static_cast<int>(completado[i]);
+        completarProceso(proceso);
+        proceso->setUltimaEjecucion(tiempoActual);
+        if (--vivos > 0 && observador != nullptr) {
+            observador->profundidadCola(tiempoActual, ultimoNivel + 1, static_cast<int>(vivos) - 1);
+        }
+    }
+    sobrecarga.tiempoUtil += total;
+}
+
+/**
+ * Avanza el reloj el costo de despachar el proceso. Si vuelve a ejecutar el
+ * mismo proceso que acaba de salir no hay cambio de contexto ni recarga. Si
+ * no, se paga el cambio más la recarga de caché: completa para un proceso
+ * que nunca ejecutó y, para los demás, proporcional a la fracción de caché
+ * perdida desde su última ejecución (la mitad por cada vidaCache sin ejecutar).
+ */
+void PlanificadorMLFQ::aplicarCostoDespacho(const Proceso* proceso) {
+    sobrecarga.despachos++;
+    if (proceso == ultimoProcesoRegistrado) {
+        return;
+    }
+    
+    int costoCache = modeloCostos.penalizacionCache;
+    if (proceso->getUltimaEjecucion() >= 0 && modeloCostos.vidaCache > 0) {
+        double transcurrido = tiempoActual - proceso->getUltimaEjecucion();
+        double fraccionPerdida = 1.0 - std::pow(0.5, transcurrido / modeloCostos.vidaCache);
+        costoCache = static_cast<int>(std::lround(costoCache * fraccionPerdida));
+    }
+    int costoCambio = modeloCostos.costoCambioContexto;
+    
+    tiempoActual += costoCambio + costoCache;
+    sobrecarga.cambiosContexto++;
+    sobrecarga.tiempoCambios += costoCambio;
+    sobrecarga.tiempoCache += costoCache;
+    
+    if (modoDebug) {
+        std::cout << "Cambio de contexto a " << proceso->getEtiqueta() << ": " << costoCambio
+                  << " + caché " << costoCache << std::endl;
+    }
+}
+
+/**
+ * Pide a la fuente el siguiente proceso y lo deja en la cola de llegada.
+ * Se llama cada vez que la cola de llegada se vacía, así siempre contiene
+ * la próxima llegada mientras la fuente tenga procesos.
+ */
+void PlanificadorMLFQ::solicitarLlegada() {
+    if (fuenteLlegadas == nullptr) return;
+    
+    Proceso* proceso = fuenteLlegadas->siguienteLlegada();
+    if (proceso != nullptr) {
+        procesos.push_back(proceso);
+        procesosLlegada.push(proceso);
+    }
+}
+
+/**
+ * Marca el tiempo de completado y avisa al observador
+ */
+void PlanificadorMLFQ::completarProceso(Proceso* proceso) {
+    proceso->setCompletionTime(tiempoActual);
+    if (observador != nullptr) {
+        observador->procesoCompletado(proceso);
+    }
+}
+
+/**
+ * Agrega un registro al historial; con la fusión activa lo une al anterior
+ * si es del mismo proceso, en el mismo nivel y sin hueco entre ambos
+ */
+void PlanificadorMLFQ::registrarEjecucion(const Proceso* proceso, const RegistroEjecucion& registro) {
+    if (fusionarHistorial && !historialEjecucion.empty() && ultimoProcesoRegistrado == proceso) {
+        RegistroEjecucion& anterior = historialEjecucion.back();
+        if (anterior.tiempoFin == registro.tiempoInicio &&
+            anterior.nivelCola == registro.nivelCola &&
+            anterior.algoritmo == registro.algoritmo) {
+            anterior.tiempoFin = registro.tiempoFin;
+            return;
+        }
+    }
+    
+    if (!historialEjecucion.empty()) {
+        if (observador != nullptr) {
+            observador->registroCerrado(historialEjecucion.back());
+        }
+        if (!guardarHistorial) {
+            historialEjecucion.clear();
+        }
+    }
+    
     historialEjecucion.push_back(registro);
+    ultimoProcesoRegistrado = proceso;
 }
 
 /**
@@ -249,10 +847,12 @@ void PlanificadorMLFQ::moverProcesoASiguienteCola(Proceso* proceso) {
     if (siguienteNivel < static_cast<int>(colas.size())) {
         // Mover a siguiente cola
         proceso->setCurrentQueueLevel(siguienteNivel + 1);
-        colas[siguienteNivel]->agregarProceso(proceso);
+        encolar(siguienteNivel, proceso);
     } else {
         // Ya está en la última cola, regresar a la misma cola
         colas[nivelActual]->devolverProceso(proceso);
+        nivelesOcupados.marcar(nivelActual);
+        avisarProfundidad(nivelActual);
     }
 }
 
@@ -260,34 +860,46 @@ void PlanificadorMLFQ::moverProcesoASiguienteCola(Proceso* proceso) {
  * Verifica si todas las colas están vacías
  */
 bool PlanificadorMLFQ::todasColasVacias() const {
-    for (const Cola* cola : colas) {
-        if (!cola->isEmpty()) {
-            return false;
-        }
-    }
-    return true;
+    return nivelesOcupados.vacio();
 }
 
 /**
- * Calcula las métricas promedio de la simulación
+ * Calcula TAT/WT de todos los procesos y las métricas promedio de la simulación.
+ * Las métricas se copian a arreglos contiguos y se procesan con los kernels
+ * vectorizados; las sumas enteras dan exactamente los mismos promedios que
+ * acumular cada valor en double.
  */
 void PlanificadorMLFQ::calcularMetricas() {
     if (procesos.empty()) return;
     
-    double sumaWT = 0, sumaCT = 0, sumaRT = 0, sumaTAT = 0;
+    size_t numProcesos = procesos.size();
+    arreglosMetricas.redimensionar(numProcesos);
+    for (size_t i = 0; i < numProcesos; i++) {
+        const Proceso* proceso = procesos[i];
+        // WT = TAT - CPU - E/S: el tiempo bloqueado no es espera en cola
+        arreglosMetricas.burst[i] = proceso->getBurstTime() + proceso->getTiempoES();
+        arreglosMetricas.llegada[i] = proceso->getArrivalTime();
+        arreglosMetricas.completado[i] = proceso->getCompletionTime();
+        arreglosMetricas.respuesta[i] = proceso->getResponseTime();
+    }
     
-    for (const Proceso* proceso : procesos) {
-        sumaWT += proceso->getWaitingTime();
-        sumaCT += proceso->getCompletionTime();
-        sumaRT += proceso->getResponseTime();
-        sumaTAT += proceso->getTurnaroundTime();
+    KernelsMetricas::calcularTiempos(arreglosMetricas);
+    
+    for (size_t i = 0; i < numProcesos; i++) {
+        if (arreglosMetricas.completado[i] > 0) {
+            procesos[i]->setTurnaroundTime(arreglosMetricas.retorno[i]);
+            procesos[i]->setWaitingTime(arreglosMetricas.espera[i]);
+        }
     }
     
-    int numProcesos = static_cast<int>(procesos.size());
-    promedioWT = sumaWT / numProcesos;
-    promedioCT = sumaCT / numProcesos;
-    promedioRT = sumaRT / numProcesos;
-    promedioTAT = sumaTAT / numProcesos;
+    estadisticas = KernelsMetricas::calcularEstadisticas(arreglosMetricas, anchoCubetaHistograma,
+                                                         numCubetasHistograma);
+    
+    double n = static_cast<double>(numProcesos);
+    promedioWT = static_cast<double>(estadisticas.wt.suma) / n;
+    promedioCT = static_cast<double>(estadisticas.ct.suma) / n;
+    promedioRT = static_cast<double>(estadisticas.rt.suma) / n;
+    promedioTAT = static_cast<double>(estadisticas.tat.suma) / n;
 }
 
 /**
@@ -330,6 +942,9 @@ void PlanificadorMLFQ::mostrarEstadoColas() const {
     for (const Cola* cola : colas) {
         cola->mostrarEstado();
     }
+    if (!bloqueados.vacia()) {
+        std::cout << "Bloqueados en E/S: " << bloqueados.getPendientes() << std::endl;
+    }
 }
 
 // Getters para métricas
@@ -338,12 +953,38 @@ double PlanificadorMLFQ::getPromedioCT() const { return promedioCT; }
 double PlanificadorMLFQ::getPromedioRT() const { return promedioRT; }
 double PlanificadorMLFQ::getPromedioTAT() const { return promedioTAT; }
 
+const EstadisticasMetricas& PlanificadorMLFQ::getEstadisticas() const {
+    return estadisticas;
+}
+
+/**
+ * Configura el histograma que se calcula junto con las métricas
+ * @param anchoCubeta: ancho de cada cubeta
+ * @param numCubetas: cantidad de cubetas (0 = sin histograma)
+ */
+void PlanificadorMLFQ::setHistograma(int anchoCubeta, int numCubetas) {
+    anchoCubetaHistograma = std::max(1, anchoCubeta);
+    numCubetasHistograma = std::max(0, numCubetas);
+}
+
 /**
  * Reinicia la simulación para ejecutar nuevamente
  */
 void PlanificadorMLFQ::reiniciarSimulacion() {
     tiempoActual = 0;
     historialEjecucion.clear();
+    ultimoProcesoRegistrado = nullptr;
+    
+    // Quantums configurados (el controlador pudo cambiarlos en una ejecución anterior)
+    for (size_t i = 0; i < colas.size() && i < configuracion.size(); i++) {
+        colas[i]->setQuantum(configuracion[i].quantum);
+    }
+    historialQuantum.clear();
+    sobrecarga = EstadisticasSobrecarga();
+    procesosConESPendiente = 0;
+    if (controladorQuantum != nullptr) {
+        controladorQuantum->reiniciar(colas.size());
+    }
     
     // Reiniciar todos los procesos
     for (Proceso* proceso : procesos) {
@@ -351,51 +992,594 @@ void PlanificadorMLFQ::reiniciarSimulacion() {
     }
     
     // Limpiar todas las colas
-    for (Cola* cola : colas) {
-        cola->limpiar();
-    }
+    vaciarColas();
     
     // Limpiar cola de llegadas
     while (!procesosLlegada.empty()) {
         procesosLlegada.pop();
     }
+    bloqueados.reiniciar();
 }
 
-std::vector<RegistroEjecucion> PlanificadorMLFQ::getHistorialEjecucion() const {
+const std::vector<RegistroEjecucion>& PlanificadorMLFQ::getHistorialEjecucion() const {
     return historialEjecucion;
 }
 
+const std::vector<Proceso*>& PlanificadorMLFQ::getProcesos() const {
+    return procesos;
+}
+
+const std::vector<ConfiguracionCola>& PlanificadorMLFQ::getConfiguracion() const {
+    return configuracion;
+}
+
+int PlanificadorMLFQ::getTiempoActual() const {
+    return tiempoActual;
+}
+
 void PlanificadorMLFQ::setModoDebug(bool debug) {
     modoDebug = debug;
 }
 
+void PlanificadorMLFQ::setFusionarHistorial(bool fusionar) {
+    fusionarHistorial = fusionar;
+}
+
+bool PlanificadorMLFQ::getFusionarHistorial() const {
+    return fusionarHistorial;
+}
+
+/**
+ * Activa el controlador que ajusta los quantums Round Robin durante la simulación
+ */
+void PlanificadorMLFQ::activarQuantumAdaptativo(const ParametrosControlQuantum& parametros) {
+    delete controladorQuantum;
+    controladorQuantum = new ControladorQuantum(parametros);
+}
+
+void PlanificadorMLFQ::desactivarQuantumAdaptativo() {
+    delete controladorQuantum;
+    controladorQuantum = nullptr;
+}
+
+bool PlanificadorMLFQ::quantumAdaptativoActivo() const {
+    return controladorQuantum != nullptr;
+}
+
+const ControladorQuantum* PlanificadorMLFQ::getControladorQuantum() const {
+    return controladorQuantum;
+}
+
+const std::vector<CambioQuantum>& PlanificadorMLFQ::getHistorialQuantum() const {
+    return historialQuantum;
+}
+
+void PlanificadorMLFQ::setModeloCostos(const ModeloCostos& modelo) {
+    modeloCostos = modelo;
+    modeloCostos.costoCambioContexto = std::max(0, modelo.costoCambioContexto);
+    modeloCostos.penalizacionCache = std::max(0, modelo.penalizacionCache);
+}
+
+const ModeloCostos& PlanificadorMLFQ::getModeloCostos() const {
+    return modeloCostos;
+}
+
+const EstadisticasSobrecarga& PlanificadorMLFQ::getSobrecarga() const {
+    return sobrecarga;
+}
+
+/**
+ * Usa una fuente incremental en lugar de los procesos agregados. Los procesos
+ * que entrega se incorporan a getProcesos() en el orden en que llegan.
+ */
+void PlanificadorMLFQ::setFuenteLlegadas(FuenteLlegadas* fuente) {
+    fuenteLlegadas = fuente;
+}
+
+void PlanificadorMLFQ::setObservador(ObservadorEjecucion* observadorEjecucion) {
+    observador = observadorEjecucion;
+}
+
+/**
+ * Permite descartar los registros ya entregados al observador, o no guardarlos
+ * si solo interesan las métricas (getHistorialEjecucion solo conserva el último)
+ */
+void PlanificadorMLFQ::setGuardarHistorial(bool guardar) {
+    guardarHistorial = guardar;
+}
+
+// Formato binario de instantáneas: enteros little-endian de 32 bits,
+// cadenas como longitud + bytes y promedios como double IEEE-754
+namespace {
+
+const char FIRMA_INSTANTANEA[8] = {'M', 'L', 'F', 'Q', 'S', 'N', 'P', '1'};
+const uint32_t VERSION_INSTANTANEA = 2;     // 2: ráfagas de E/S y procesos bloqueados
+
+class EscritorBinario {
+public:
+    explicit EscritorBinario(std::string& destino) : datos(destino) {}
+    
+    void entero(int32_t valor) {
+        uint32_t v = static_cast<uint32_t>(valor);
+        for (int i = 0; i < 4; i++) {
+            datos.push_back(static_cast<char>((v >> (8 * i)) & 0xFF));
+        }
+    }
+    
+    void real(double valor) {
+        uint64_t bits;
+        std::memcpy(&bits, &valor, sizeof(bits));
+        entero(static_cast<int32_t>(bits & 0xFFFFFFFFu));
+        entero(static_cast<int32_t>(bits >> 32));
+    }
+    
+    void cadena(const std::string& texto) {
+        entero(static_cast<int32_t>(texto.size()));
+        datos.append(texto);
+    }
+    
+private:
+    std::string& datos;
+};
+
+class LectorBinario {
+public:
+    explicit LectorBinario(const std::string& origen) : datos(origen), posicion(0), valido(true) {}
+    
+    int32_t entero() {
+        if (posicion + 4 > datos.size()) {
+            valido = false;
+            return 0;
+        }
+        uint32_t v = 0;
+        for (int i = 0; i < 4; i++) {
+            v |= static_cast<uint32_t>(static_cast<unsigned char>(datos[posicion + i])) << (8 * i);
+        }
+        posicion += 4;
+        return static_cast<int32_t>(v);
+    }
+    
+    double real() {
+        uint64_t bajo = static_cast<uint32_t>(entero());
+        uint64_t alto = static_cast<uint32_t>(entero());
+        uint64_t bits = bajo | (alto << 32);
+        double valor;
+        std::memcpy(&valor, &bits, sizeof(valor));
+        return valor;
+    }
+    
+    std::string cadena() {
+        int32_t longitud = entero();
+        if (longitud < 0 || posicion + static_cast<size_t>(longitud) > datos.size()) {
+            valido = false;
+            return "";
+        }
+        std::string texto = datos.substr(posicion, longitud);
+        posicion += longitud;
+        return texto;
+    }
+    
+    bool firma() {
+        if (datos.size() < sizeof(FIRMA_INSTANTANEA) ||
+            datos.compare(0, sizeof(FIRMA_INSTANTANEA), FIRMA_INSTANTANEA, sizeof(FIRMA_INSTANTANEA)) != 0) {
+            valido = false;
+            return false;
+        }
+        posicion = sizeof(FIRMA_INSTANTANEA);
+        return true;
+    }
+    
+    void invalidar() { valido = false; }
+    bool esValido() const { return valido; }
+    
+private:
+    const std::string& datos;
+    size_t posicion;
+    bool valido;
+};
+
+} // namespace
+
+/**
+ * Serializa el estado completo de la simulación en una instantánea binaria.
+ * Los procesos se identifican por su posición en el vector de procesos.
+ */
+std::string PlanificadorMLFQ::crearInstantanea() const {
+    std::string datos(FIRMA_INSTANTANEA, sizeof(FIRMA_INSTANTANEA));
+    EscritorBinario escritor(datos);
+    escritor.entero(VERSION_INSTANTANEA);
+    
+    // Configuración de colas
+    escritor.entero(static_cast<int32_t>(configuracion.size()));
+    for (const auto& config : configuracion) {
+        escritor.entero(config.nivel);
+        escritor.entero(static_cast<int32_t>(config.algoritmo));
+        escritor.entero(config.quantum);
+    }
+    
+    escritor.entero(tiempoActual);
+    
+    // Definición y estado de cada proceso
+    escritor.entero(static_cast<int32_t>(procesos.size()));
+    for (const Proceso* proceso : procesos) {
+        escritor.cadena(proceso->getEtiqueta());
+        escritor.entero(proceso->getBurstTime());
+        escritor.entero(proceso->getArrivalTime());
+        escritor.entero(proceso->getQueueLevel());
+        escritor.entero(proceso->getPriority());
+        escritor.entero(proceso->getBurstTimeRestante());
+        escritor.entero(proceso->getWaitingTime());
+        escritor.entero(proceso->getCompletionTime());
+        escritor.entero(proceso->getResponseTime());
+        escritor.entero(proceso->getTurnaroundTime());
+        escritor.entero(proceso->getHasStarted() ? 1 : 0);
+        escritor.entero(proceso->getIsCompleted() ? 1 : 0);
+        escritor.entero(proceso->getCurrentQueueLevel());
+        escritor.entero(static_cast<int32_t>(proceso->getRafagas().size()));
+        for (int rafaga : proceso->getRafagas()) {
+            escritor.entero(rafaga);
+        }
+        escritor.entero(proceso->getIndiceRafaga());
+        escritor.entero(proceso->getRafagaCPURestante());
+    }
+    
+    // Índice de cada proceso para referenciarlo desde colas y llegadas
+    std::unordered_map<const Proceso*, int32_t> indices;
+    indices.reserve(procesos.size());
+    for (size_t i = 0; i < procesos.size(); i++) {
+        indices.emplace(procesos[i], static_cast<int32_t>(i));
+    }
+    auto indiceDe = [&indices](const Proceso* proceso) {
+        auto encontrado = indices.find(proceso);
+        return encontrado != indices.end() ? encontrado->second : static_cast<int32_t>(indices.size());
+    };
+    
+    // Llegadas pendientes en orden
+    std::queue<Proceso*> llegadas = procesosLlegada;
+    escritor.entero(static_cast<int32_t>(llegadas.size()));
+    while (!llegadas.empty()) {
+        escritor.entero(indiceDe(llegadas.front()));
+        llegadas.pop();
+    }
+    
+    // Contenido de cada cola en orden de despacho
+    for (const Cola* cola : colas) {
+        std::vector<Proceso*> contenido = cola->obtenerTodosProcesos();
+        escritor.entero(static_cast<int32_t>(contenido.size()));
+        for (const Proceso* proceso : contenido) {
+            escritor.entero(indiceDe(proceso));
+        }
+    }
+    
+    // Procesos bloqueados en E/S en orden de despertar
+    std::vector<RuedaTemporizadores::Temporizador> pendientes = bloqueados.obtenerPendientes();
+    escritor.entero(static_cast<int32_t>(pendientes.size()));
+    for (const auto& temporizador : pendientes) {
+        escritor.entero(indiceDe(temporizador.proceso));
+        escritor.entero(temporizador.vencimiento);
+    }
+    
+    // Historial de ejecución
+    escritor.entero(static_cast<int32_t>(historialEjecucion.size()));
+    for (const auto& registro : historialEjecucion) {
+        escritor.cadena(registro.etiquetaProceso);
+        escritor.entero(registro.tiempoInicio);
+        escritor.entero(registro.tiempoFin);
+        escritor.entero(registro.nivelCola);
+        escritor.cadena(registro.algoritmo);
+    }
+    
+    // Acumuladores de métricas
+    escritor.real(promedioWT);
+    escritor.real(promedioCT);
+    escritor.real(promedioRT);
+    escritor.real(promedioTAT);
+    
+    return datos;
+}
+
+/**
+ * Restaura el estado desde una instantánea. Los procesos se recrean y pasan a
+ * ser propiedad del planificador (se liberan con limpiarProcesos).
+ * Si el planificador ya tiene colas configuradas con el mismo número de niveles
+ * se conservan, lo que permite continuar con algoritmos distintos; en otro caso
+ * se usa la configuración guardada en la instantánea.
+ * @return false si la instantánea está corrupta o no es compatible
+ */
+bool PlanificadorMLFQ::restaurarInstantanea(const std::string& datos) {
+    LectorBinario lector(datos);
+    int32_t version = lector.firma() ? lector.entero() : 0;
+    if (version < 1 || version > static_cast<int32_t>(VERSION_INSTANTANEA)) {
+        std::cerr << "Error: Instantánea con formato o versión no reconocidos." << std::endl;
+        return false;
+    }
+    
+    // Misma configuración que acepta la simulación: niveles 1..N en orden,
+    // algoritmo conocido y quantum positivo (con quantum 0 el RR no avanza)
+    std::vector<ConfiguracionCola> configGuardada;
+    int32_t numNiveles = lector.entero();
+    if (numNiveles < 1 || numNiveles > MapaNiveles::MAX_NIVELES) {
+        lector.invalidar();
+    }
+    for (int32_t i = 0; i < numNiveles && lector.esValido(); i++) {
+        int32_t nivel = lector.entero();
+        int32_t algoritmo = lector.entero();
+        int32_t quantum = lector.entero();
+        if (nivel != i + 1 || algoritmo < static_cast<int32_t>(TipoAlgoritmo::ROUND_ROBIN) ||
+            algoritmo > static_cast<int32_t>(TipoAlgoritmo::STCF) || quantum <= 0) {
+            lector.invalidar();
+            break;
+        }
+        configGuardada.push_back(ConfiguracionCola(nivel, static_cast<TipoAlgoritmo>(algoritmo), quantum));
+    }
+    
+    int32_t tiempoGuardado = lector.entero();
+    
+    std::vector<Proceso*> restaurados;
+    int32_t numProcesos = lector.entero();
+    for (int32_t i = 0; i < numProcesos && lector.esValido(); i++) {
+        std::string etiqueta = lector.cadena();
+        int32_t burstTime = lector.entero();
+        int32_t arrivalTime = lector.entero();
+        int32_t queueLevel = lector.entero();
+        int32_t priority = lector.entero();
+        
+        // Los campos de ráfagas (versión 2) van al final; se leen antes de crear el proceso
+        int32_t estado[8];
+        for (int32_t& campo : estado) {
+            campo = lector.entero();
+        }
+        std::vector<int> rafagas;
+        int32_t indiceRafaga = 0;
+        int32_t rafagaRestante = 0;
+        if (version >= 2) {
+            // Ráfagas CPU, E/S, ..., CPU, todas positivas, y la actual es de CPU
+            int32_t numRafagas = lector.entero();
+            if (numRafagas < 0 || (numRafagas > 1 && numRafagas % 2 == 0)) {
+                lector.invalidar();
+            }
+            for (int32_t r = 0; r < numRafagas && lector.esValido(); r++) {
+                rafagas.push_back(lector.entero());
+                if (rafagas.back() <= 0) {
+                    lector.invalidar();
+                }
+            }
+            indiceRafaga = lector.entero();
+            rafagaRestante = lector.entero();
+            if (rafagas.size() > 1 &&
+                (indiceRafaga < 0 || indiceRafaga >= numRafagas || indiceRafaga % 2 != 0 ||
+                 rafagaRestante < 0 || rafagaRestante > rafagas[indiceRafaga])) {
+                lector.invalidar();
+            }
+        }
+        if (!lector.esValido()) {
+            break;
+        }
+        
+        Proceso* proceso = rafagas.size() > 1
+            ? new Proceso(etiqueta, rafagas, arrivalTime, queueLevel, priority)
+            : new Proceso(etiqueta, burstTime, arrivalTime, queueLevel, priority);
+        proceso->setBurstTimeRestante(estado[0]);
+        proceso->setWaitingTime(estado[1]);
+        proceso->setCompletionTime(estado[2]);
+        proceso->setResponseTime(estado[3]);
+        proceso->setTurnaroundTime(estado[4]);
+        proceso->setHasStarted(estado[5] != 0);
+        proceso->setIsCompleted(estado[6] != 0);
+        proceso->setCurrentQueueLevel(estado[7]);
+        if (proceso->esMultirafaga()) {
+            proceso->setEstadoRafaga(indiceRafaga, rafagaRestante);
+        }
+        restaurados.push_back(proceso);
+        if (estado[0] < 0 || estado[0] > proceso->getBurstTime()) {
+            lector.invalidar();
+        }
+    }
+    
+    // Cada proceso pendiente está en un solo lugar (llegadas, una cola o E/S)
+    std::vector<bool> referenciado(restaurados.size(), false);
+    auto procesoEn = [&restaurados, &referenciado, &lector](int32_t indice) -> Proceso* {
+        if (indice < 0 || indice >= static_cast<int32_t>(restaurados.size()) || referenciado[indice]) {
+            lector.invalidar();
+            return nullptr;
+        }
+        referenciado[indice] = true;
+        return restaurados[indice];
+    };
+    // Un proceso en cola o en E/S vuelve a la cola de su nivel actual
+    auto nivelValido = [&configGuardada](const Proceso* proceso) {
+        return proceso != nullptr && !proceso->getIsCompleted() &&
+               proceso->getCurrentQueueLevel() >= 1 &&
+               proceso->getCurrentQueueLevel() <= static_cast<int>(configGuardada.size());
+    };
+    
+    std::vector<Proceso*> llegadas;
+    int32_t numLlegadas = lector.entero();
+    for (int32_t i = 0; i < numLlegadas && lector.esValido(); i++) {
+        llegadas.push_back(procesoEn(lector.entero()));
+    }
+    
+    std::vector<std::vector<Proceso*>> contenidoColas(configGuardada.size());
+    for (size_t nivel = 0; nivel < configGuardada.size() && lector.esValido(); nivel++) {
+        int32_t cantidad = lector.entero();
+        for (int32_t i = 0; i < cantidad && lector.esValido(); i++) {
+            Proceso* proceso = procesoEn(lector.entero());
+            if (!nivelValido(proceso) || proceso->getCurrentQueueLevel() != static_cast<int>(nivel) + 1) {
+                lector.invalidar();
+                break;
+            }
+            contenidoColas[nivel].push_back(proceso);
+        }
+    }
+    
+    std::vector<RuedaTemporizadores::Temporizador> enES;
+    int32_t numBloqueados = (version >= 2) ? lector.entero() : 0;
+    for (int32_t i = 0; i < numBloqueados && lector.esValido(); i++) {
+        RuedaTemporizadores::Temporizador temporizador;
+        temporizador.proceso = procesoEn(lector.entero());
+        temporizador.vencimiento = lector.entero();
+        if (!nivelValido(temporizador.proceso)) {
+            lector.invalidar();
+            break;
+        }
+        enES.push_back(temporizador);
+    }
+    
+    std::vector<RegistroEjecucion> historial;
+    int32_t numRegistros = lector.entero();
+    for (int32_t i = 0; i < numRegistros && lector.esValido(); i++) {
+        RegistroEjecucion registro;
+        registro.etiquetaProceso = lector.cadena();
+        registro.tiempoInicio = lector.entero();
+        registro.tiempoFin = lector.entero();
+        registro.nivelCola = lector.entero();
+        registro.algoritmo = lector.cadena();
+        historial.push_back(registro);
+    }
+    
+    double wt = lector.real();
+    double ct = lector.real();
+    double rt = lector.real();
+    double tat = lector.real();
+    
+    if (!lector.esValido()) {
+        for (Proceso* proceso : restaurados) {
+            delete proceso;
+        }
+        std::cerr << "Error: Instantánea truncada o corrupta." << std::endl;
+        return false;
+    }
+    
+    // Aplicar el estado restaurado
+    limpiarProcesos();
+    if (colas.size() != configGuardada.size()) {
+        configurarColas(configGuardada);
+    }
+    
+    procesos = restaurados;
+    tiempoActual = tiempoGuardado;
+    for (Proceso* proceso : llegadas) {
+        procesosLlegada.push(proceso);
+    }
+    // Cargar cada cola en el orden guardado: encolar uno a uno reordenaría SJF/STCF
+    // y los empates podrían salir en otro orden que en la ejecución original
+    for (size_t nivel = 0; nivel < contenidoColas.size(); nivel++) {
+        if (contenidoColas[nivel].empty()) continue;
+        colas[nivel]->cargarEnOrden(contenidoColas[nivel]);
+        nivelesOcupados.marcar(static_cast<int>(nivel));
+        avisarProfundidad(static_cast<int>(nivel));
+    }
+    bloqueados.reiniciar(tiempoActual);
+    for (const auto& temporizador : enES) {
+        bloqueados.programar(temporizador.proceso, temporizador.vencimiento);
+    }
+    procesosConESPendiente = 0;
+    for (size_t nivel = 0; nivel < contenidoColas.size(); nivel++) {
+        for (const Proceso* proceso : contenidoColas[nivel]) {
+            procesosConESPendiente += (proceso->getRafagaCPURestante() < proceso->getBurstTimeRestante()) ? 1 : 0;
+        }
+    }
+    for (const auto& temporizador : enES) {
+        const Proceso* proceso = temporizador.proceso;
+        procesosConESPendiente += (proceso->getRafagaCPURestante() < proceso->getBurstTimeRestante()) ? 1 : 0;
+    }
+    historialEjecucion = historial;
+    promedioWT = wt;
+    promedioCT = ct;
+    promedioRT = rt;
+    promedioTAT = tat;
+    
+    return true;
+}
+
+/**
+ * Crea una continuación por cada configuración a partir de la misma instantánea.
+ * Todas comparten el prefijo ya simulado (reloj, historial y estado de procesos)
+ * y solo difieren en las colas con que continúan.
+ * @return planificadores listos para continuarSimulacion(); el llamador los libera
+ */
+std::vector<PlanificadorMLFQ*> PlanificadorMLFQ::bifurcar(
+        const std::string& instantanea,
+        const std::vector<std::vector<ConfiguracionCola>>& continuaciones) {
+    std::vector<PlanificadorMLFQ*> planificadores;
+    
+    for (const auto& configuraciones : continuaciones) {
+        PlanificadorMLFQ* planificador = new PlanificadorMLFQ();
+        planificador->configurarColas(configuraciones);
+        
+        if (!planificador->restaurarInstantanea(instantanea)) {
+            delete planificador;
+            for (PlanificadorMLFQ* creado : planificadores) {
+                creado->limpiarProcesos();
+                delete creado;
+            }
+            return std::vector<PlanificadorMLFQ*>();
+        }
+        planificadores.push_back(planificador);
+    }
+    
+    return planificadores;
+}
+
 // Configuraciones predefinidas
-void PlanificadorMLFQ::configuracionA() {
-    std::vector<ConfiguracionCola> config = {
+std::vector<ConfiguracionCola> PlanificadorMLFQ::obtenerConfiguracionA() {
+    return {
         ConfiguracionCola(1, TipoAlgoritmo::ROUND_ROBIN, 1),
         ConfiguracionCola(2, TipoAlgoritmo::ROUND_ROBIN, 3),
         ConfiguracionCola(3, TipoAlgoritmo::ROUND_ROBIN, 4),
         ConfiguracionCola(4, TipoAlgoritmo::SJF)
     };
-    configurarColas(config);
 }
 
-void PlanificadorMLFQ::configuracionB() {
-    std::vector<ConfiguracionCola> config = {
+std::vector<ConfiguracionCola> PlanificadorMLFQ::obtenerConfiguracionB() {
+    return {
         ConfiguracionCola(1, TipoAlgoritmo::ROUND_ROBIN, 2),
         ConfiguracionCola(2, TipoAlgoritmo::ROUND_ROBIN, 3),
         ConfiguracionCola(3, TipoAlgoritmo::ROUND_ROBIN, 4),
         ConfiguracionCola(4, TipoAlgoritmo::STCF)
     };
-    configurarColas(config);
 }
 
-void PlanificadorMLFQ::configuracionC() {
-    std::vector<ConfiguracionCola> config = {
+std::vector<ConfiguracionCola> PlanificadorMLFQ::obtenerConfiguracionC() {
+    return {
         ConfiguracionCola(1, TipoAlgoritmo::ROUND_ROBIN, 3),
         ConfiguracionCola(2, TipoAlgoritmo::ROUND_ROBIN, 5),
         ConfiguracionCola(3, TipoAlgoritmo::ROUND_ROBIN, 6),
         ConfiguracionCola(4, TipoAlgoritmo::ROUND_ROBIN, 20)
     };
-    configurarColas(config);
-}
\ No newline at end of file
+}
+
+/**
+ * Obtiene una configuración predefinida por su letra (A, B o C)
+ * @return false si la letra no corresponde a ninguna configuración
+ */
+bool PlanificadorMLFQ::obtenerConfiguracionPredefinida(char letra, std::vector<ConfiguracionCola>& configuraciones) {
+    switch (letra) {
+        case 'A':
+        case 'a':
+            configuraciones = obtenerConfiguracionA();
+            return true;
+        case 'B':
+        case 'b':
+            configuraciones = obtenerConfiguracionB();
+            return true;
+        case 'C':
+        case 'c':
+            configuraciones = obtenerConfiguracionC();
+            return true;
+        default:
+            return false;
+    }
+}
+
+void PlanificadorMLFQ::configuracionA() {
+    configurarColas(obtenerConfiguracionA());
+}
+
+void PlanificadorMLFQ::configuracionB() {
+    configurarColas(obtenerConfiguracionB());
+}
+
+void PlanificadorMLFQ::configuracionC() {
+    configurarColas(obtenerConfiguracionC());
+}
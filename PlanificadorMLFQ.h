@@ -6,6 +6,10 @@
 #include <queue>
 #include "Proceso.h"
 #include "Cola.h"
+#include "KernelsMetricas.h"
+#include "ControladorQuantum.h"
+#include "RuedaTemporizadores.h"
+#include "MapaNiveles.h"
 
 /**
  * Estructura para registrar la ejecución de procesos
@@ -18,6 +22,47 @@ struct RegistroEjecucion {
     std::string algoritmo;
 };
 
+/**
+ * Origen incremental de procesos ordenados por tiempo de llegada. Permite
+ * empezar a simular antes de tener toda la carga en memoria.
+ */
+class FuenteLlegadas {
+public:
+    virtual ~FuenteLlegadas() {}
+    
+    /**
+     * Siguiente proceso en orden de llegada (puede esperar a que esté disponible)
+     * @return nullptr cuando no quedan procesos
+     */
+    virtual Proceso* siguienteLlegada() = 0;
+};
+
+/**
+ * Recibe los eventos de la simulación a medida que ocurren
+ */
+class ObservadorEjecucion {
+public:
+    virtual ~ObservadorEjecucion() {}
+    
+    // Registro del historial que ya no cambiará (con la fusión, el último puede seguir creciendo)
+    virtual void registroCerrado(const RegistroEjecucion& registro) { (void)registro; }
+    
+    // Proceso terminado; su tiempo de completado y de respuesta ya son definitivos
+    virtual void procesoCompletado(const Proceso* proceso) { (void)proceso; }
+    
+    // Procesos esperando en una cola (nivel desde 1) después de encolar o extraer
+    virtual void profundidadCola(int tiempo, int nivel, int procesos) { (void)tiempo; (void)nivel; (void)procesos; }
+    
+    // Los mismos eventos en PlanificadorMulticore, con el núcleo (desde 0) al que
+    // pertenecen. Intervalos y fines se reenvían por defecto a los de un núcleo;
+    // la profundidad no, porque es la de la cola de un solo núcleo
+    virtual void registroCerradoNucleo(int nucleo, const RegistroEjecucion& registro) { (void)nucleo; registroCerrado(registro); }
+    virtual void procesoCompletadoNucleo(int nucleo, const Proceso* proceso) { (void)nucleo; procesoCompletado(proceso); }
+    virtual void profundidadColaNucleo(int tiempo, int nucleo, int nivel, int procesos) {
+        (void)tiempo; (void)nucleo; (void)nivel; (void)procesos;
+    }
+};
+
 /**
  * Estructura para configurar cada cola del MLFQ
  */
@@ -30,29 +75,90 @@ struct ConfiguracionCola {
         : nivel(n), algoritmo(alg), quantum(q) {}
 };
 
+/**
+ * Costo de despachar un proceso. Con los valores por defecto los cambios son
+ * gratuitos, como en la simulación original.
+ */
+struct ModeloCostos {
+    int costoCambioContexto;        // Tiempo de CPU de cada cambio a otro proceso
+    int penalizacionCache;          // Recarga de caché de un proceso frío (nunca ejecutado)
+    double vidaCache;               // Tiempo sin ejecutar en que la caché pierde la mitad de su utilidad
+    
+    ModeloCostos() : costoCambioContexto(0), penalizacionCache(0), vidaCache(10.0) {}
+    
+    bool activo() const { return costoCambioContexto > 0 || penalizacionCache > 0; }
+};
+
+/**
+ * Tiempo de CPU perdido en despachos durante una simulación
+ */
+struct EstadisticasSobrecarga {
+    long long tiempoCambios;        // Tiempo en cambios de contexto
+    long long tiempoCache;          // Tiempo en recarga de caché
+    long long tiempoUtil;           // Tiempo ejecutando procesos
+    int cambiosContexto;
+    int despachos;
+    
+    EstadisticasSobrecarga() : tiempoCambios(0), tiempoCache(0), tiempoUtil(0), cambiosContexto(0), despachos(0) {}
+};
+
 /**
  * Clase principal que implementa el Multi-Level Feedback Queue
  */
 class PlanificadorMLFQ {
 private:
     std::vector<Cola*> colas;                           // Colas del MLFQ ordenadas por prioridad
+    MapaNiveles nivelesOcupados;                        // Colas no vacías, para elegir en O(1)
     std::vector<Proceso*> procesos;                     // Lista de todos los procesos
     std::vector<RegistroEjecucion> historialEjecucion; // Registro de ejecución
     std::queue<Proceso*> procesosLlegada;               // Cola de procesos por llegar
+    RuedaTemporizadores bloqueados;                     // Procesos en E/S, por tiempo de despertar
+    std::vector<Proceso*> despertados;                  // Auxiliar de procesarDespertares
+    int procesosConESPendiente;                         // Llegados sin terminar que aún harán E/S
+    std::vector<ConfiguracionCola> configuracion;       // Configuración usada para crear las colas
     
     int tiempoActual;                                   // Tiempo actual de la simulación
     bool modoDebug;                                     // Para mostrar información detallada
+    bool fusionarHistorial;                             // Une intervalos consecutivos del mismo proceso
+    const Proceso* ultimoProcesoRegistrado;             // Proceso del último registro del historial
+    FuenteLlegadas* fuenteLlegadas;                     // Origen incremental de procesos (opcional)
+    ObservadorEjecucion* observador;                    // Receptor de eventos (opcional)
+    bool guardarHistorial;                              // false: solo se conserva el último registro
+    ControladorQuantum* controladorQuantum;             // Ajuste automático de quantums (opcional)
+    std::vector<CambioQuantum> historialQuantum;        // Cambios aplicados por el controlador
+    ModeloCostos modeloCostos;                          // Costo de cambios de contexto y caché
+    EstadisticasSobrecarga sobrecarga;
     
     // Métricas calculadas
     double promedioWT;
     double promedioCT;
     double promedioRT;
     double promedioTAT;
+    EstadisticasMetricas estadisticas;                  // Suma, mínimo, máximo e histograma por métrica
+    ArreglosMetricas arreglosMetricas;                  // Métricas en arreglos contiguos para los kernels
+    int anchoCubetaHistograma;
+    int numCubetasHistograma;
+    
+    void encolar(int indiceNivel, Proceso* proceso);
+    void avisarProfundidad(int indiceNivel);
+    void vaciarColas();
+    void registrarEjecucion(const Proceso* proceso, const RegistroEjecucion& registro);
+    void completarProceso(Proceso* proceso);
+    void solicitarLlegada();
+    void aplicarCostoDespacho(const Proceso* proceso);
+    void bloquearProceso(Proceso* proceso);
+    int proximoEvento() const;
+    int calcularTiempoSinInterrupcion(const Proceso* proceso, const Cola* cola) const;
+    bool rondasFinalesResolubles() const;
+    bool admiteParticiones() const;
+    void resolverRondasFinales();
     
 public:
     // Constructor y destructor
     PlanificadorMLFQ(bool debug = false);
     ~PlanificadorMLFQ();
+    PlanificadorMLFQ(const PlanificadorMLFQ&) = delete;
+    PlanificadorMLFQ& operator=(const PlanificadorMLFQ&) = delete;
     
     // Configuración del planificador
     void configurarColas(const std::vector<ConfiguracionCola>& configuraciones);
@@ -61,7 +167,14 @@ public:
     
     // Métodos principales de simulación
     void ejecutarSimulacion();
+    int ejecutarSimulacionParalela(int hilos);          // Periodos ocupados en paralelo; devuelve las particiones
+    void iniciarSimulacion();                           // Reinicia y prepara la cola de llegadas
+    void avanzarPaso();                                 // Una iteración del bucle principal
+    void ejecutarHasta(int tiempoLimite);               // Avanza mientras tiempoActual < tiempoLimite
+    void continuarSimulacion();                         // Avanza hasta terminar y calcula métricas
+    bool simulacionTerminada() const;
     void procesarLlegadas();                            // Procesa procesos que llegan en tiempo actual
+    void procesarDespertares();                         // Devuelve a su cola los procesos cuya E/S terminó
     Proceso* seleccionarProcesoParaEjecutar();         // Selecciona proceso de mayor prioridad
     void ejecutarProceso(Proceso* proceso);            // Ejecuta un proceso según su algoritmo
     void moverProcesoASiguienteCola(Proceso* proceso); // Mueve proceso a cola de menor prioridad
@@ -76,17 +189,51 @@ public:
     double getPromedioCT() const;
     double getPromedioRT() const;
     double getPromedioTAT() const;
+    const EstadisticasMetricas& getEstadisticas() const;
+    void setHistograma(int anchoCubeta, int numCubetas);
+    
+    // Instantáneas del estado completo (reloj, colas, llegadas pendientes, historial)
+    std::string crearInstantanea() const;
+    bool restaurarInstantanea(const std::string& datos);
+    static std::vector<PlanificadorMLFQ*> bifurcar(const std::string& instantanea,
+                                                   const std::vector<std::vector<ConfiguracionCola>>& continuaciones);
     
     // Métodos de utilidad
     void reiniciarSimulacion();
-    std::vector<RegistroEjecucion> getHistorialEjecucion() const;
+    const std::vector<RegistroEjecucion>& getHistorialEjecucion() const;
+    const std::vector<Proceso*>& getProcesos() const;
+    const std::vector<ConfiguracionCola>& getConfiguracion() const;
+    int getTiempoActual() const;
     void setModoDebug(bool debug);
+    void setFusionarHistorial(bool fusionar);
+    bool getFusionarHistorial() const;
+    void setFuenteLlegadas(FuenteLlegadas* fuente);
+    void setObservador(ObservadorEjecucion* observadorEjecucion);
+    void setGuardarHistorial(bool guardar);
+    
+    // Ajuste automático de quantums (no se guarda en las instantáneas)
+    void activarQuantumAdaptativo(const ParametrosControlQuantum& parametros);
+    void desactivarQuantumAdaptativo();
+    bool quantumAdaptativoActivo() const;
+    const ControladorQuantum* getControladorQuantum() const;    // nullptr si no está activo
+    const std::vector<CambioQuantum>& getHistorialQuantum() const;
+    
+    // Costo de despacho (no se guarda en las instantáneas)
+    void setModeloCostos(const ModeloCostos& modelo);
+    const ModeloCostos& getModeloCostos() const;
+    const EstadisticasSobrecarga& getSobrecarga() const;
     bool todasColasVacias() const;
     
     // Métodos para diferentes configuraciones predefinidas
     void configuracionA();  // RR(1), RR(3), RR(4), SJF
     void configuracionB();  // RR(2), RR(3), RR(4), STCF
     void configuracionC();  // RR(3), RR(5), RR(6), RR(20)
+    
+    // Descripción de las configuraciones predefinidas (reutilizada por otros motores)
+    static std::vector<ConfiguracionCola> obtenerConfiguracionA();
+    static std::vector<ConfiguracionCola> obtenerConfiguracionB();
+    static std::vector<ConfiguracionCola> obtenerConfiguracionC();
+    static bool obtenerConfiguracionPredefinida(char letra, std::vector<ConfiguracionCola>& configuraciones);
 };
 
 #endif // PLANIFICADOR_MLFQ_H
\ No newline at end of file
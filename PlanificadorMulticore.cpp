@@ -0,0 +1,512 @@
+#include "PlanificadorMulticore.h"
+#include "KernelsMetricas.h"
+#include "OrdenLlegadas.h"
+#include <iostream>
+#include <algorithm>
+#include <iomanip>
+#include <climits>
+
+/**
+ * Constructor del PlanificadorMulticore
+ */
+PlanificadorMulticore::PlanificadorMulticore(int numNucleos, bool debug)
+    : numNucleos(std::max(1, numNucleos)), politica(PoliticaUbicacion::MENOS_CARGADO),
+      costoMigracion(0), siguienteLlegada(0), siguienteNucleoRR(0), makespan(0),
+      modoDebug(debug), observador(nullptr), promedioWT(0), promedioCT(0), promedioRT(0), promedioTAT(0),
+      desbalanceCarga(0) {
+    nucleos.resize(this->numNucleos);
+    estadisticas.resize(this->numNucleos);
+}
+
+/**
+ * Destructor - libera memoria de las colas de todos los núcleos
+ */
+PlanificadorMulticore::~PlanificadorMulticore() {
+    liberarColas();
+}
+
+void PlanificadorMulticore::liberarColas() {
+    for (EstadoNucleo& nucleo : nucleos) {
+        for (Cola* cola : nucleo.colas) {
+            delete cola;
+        }
+        nucleo.colas.clear();
+    }
+}
+
+/**
+ * Configura las colas: cada núcleo recibe una copia del mismo esquema de niveles
+ */
+void PlanificadorMulticore::configurarColas(const std::vector<ConfiguracionCola>& configuraciones) {
+    liberarColas();
+    configuracion = configuraciones;
+
+    for (EstadoNucleo& nucleo : nucleos) {
+        for (const auto& config : configuraciones) {
+            nucleo.colas.push_back(new Cola(config.nivel, config.algoritmo, config.quantum));
+        }
+    }
+}
+
+void PlanificadorMulticore::setPoliticaUbicacion(PoliticaUbicacion politica) {
+    this->politica = politica;
+}
+
+void PlanificadorMulticore::setCostoMigracion(int costo) {
+    costoMigracion = std::max(0, costo);
+}
+
+/**
+ * Conecta un receptor de eventos: cada intervalo al despacharse, cada proceso
+ * al terminar y la profundidad de cada cola de cada núcleo al cambiar
+ */
+void PlanificadorMulticore::setObservador(ObservadorEjecucion* observadorEjecucion) {
+    observador = observadorEjecucion;
+}
+
+void PlanificadorMulticore::agregarProceso(Proceso* proceso) {
+    if (proceso != nullptr) {
+        procesos.push_back(proceso);
+    }
+}
+
+/**
+ * Limpia todos los procesos del planificador
+ */
+void PlanificadorMulticore::limpiarProcesos() {
+    for (Proceso* proceso : procesos) {
+        delete proceso;
+    }
+    procesos.clear();
+
+    for (EstadoNucleo& nucleo : nucleos) {
+        for (Cola* cola : nucleo.colas) {
+            cola->limpiar();
+        }
+        nucleo.enEjecucion = nullptr;
+    }
+    historialEjecucion.clear();
+}
+
+/**
+ * Ejecuta la simulación de todos los núcleos como eventos discretos.
+ * En cada iteración avanza el núcleo con el evento más próximo; ante empate
+ * se atienden primero los núcleos que terminan un intervalo y luego los ociosos,
+ * de modo que un núcleo ocioso ve el trabajo que los demás acaban de devolver.
+ */
+void PlanificadorMulticore::ejecutarSimulacion() {
+    if (procesos.empty() || configuracion.empty()) {
+        std::cout << "Error: No hay procesos o colas configuradas." << std::endl;
+        return;
+    }
+    // Los núcleos no bloquean procesos en E/S: con ráfagas alternadas las
+    // métricas saldrían como si la E/S no existiera
+    for (const Proceso* proceso : procesos) {
+        if (proceso->esMultirafaga()) {
+            std::cout << "Error: La simulación multinúcleo no admite ráfagas de E/S (proceso "
+                      << proceso->getEtiqueta() << ")." << std::endl;
+            return;
+        }
+    }
+
+    // Reiniciar estado
+    historialEjecucion.clear();
+    for (Proceso* proceso : procesos) {
+        proceso->reset();
+    }
+    for (int i = 0; i < numNucleos; i++) {
+        for (Cola* cola : nucleos[i].colas) {
+            cola->limpiar();
+        }
+        nucleos[i].tiempoLibre = 0;
+        nucleos[i].enEjecucion = nullptr;
+        nucleos[i].inactivo = true;
+        estadisticas[i] = EstadisticasNucleo{0, 0, 0, 0, 0.0};
+    }
+    siguienteLlegada = 0;
+    siguienteNucleoRR = 0;
+    makespan = 0;
+
+    // Ordenar procesos por tiempo de llegada (estable: respeta el orden del archivo)
+    OrdenLlegadas::ordenarEstable(procesos);
+
+    while (true) {
+        // Elegir el núcleo con el evento más próximo
+        int actual = -1;
+        for (int i = 0; i < numNucleos; i++) {
+            if (nucleos[i].tiempoLibre == INT_MAX) continue;
+            if (actual < 0 ||
+                nucleos[i].tiempoLibre < nucleos[actual].tiempoLibre ||
+                (nucleos[i].tiempoLibre == nucleos[actual].tiempoLibre &&
+                 !nucleos[i].inactivo && nucleos[actual].inactivo)) {
+                actual = i;
+            }
+        }
+        if (actual < 0) break;
+
+        int tiempo = nucleos[actual].tiempoLibre;
+
+        finalizarIntervalo(actual);
+        procesarLlegadas(tiempo);
+
+        bool migrado = false;
+        Proceso* proceso = tomarProcesoLocal(actual, tiempo);
+        if (proceso == nullptr) {
+            proceso = robarProceso(actual, tiempo);
+            migrado = (proceso != nullptr);
+        }
+
+        if (proceso != nullptr) {
+            despachar(actual, proceso, tiempo, migrado);
+        } else {
+            nucleos[actual].inactivo = true;
+            nucleos[actual].tiempoLibre = siguienteEvento(actual, tiempo);
+        }
+
+        // Despertar núcleos ociosos si quedó trabajo encolado que puedan robar
+        bool hayTrabajo = false;
+        for (int i = 0; i < numNucleos && !hayTrabajo; i++) {
+            hayTrabajo = procesosEncolados(i) > 0;
+        }
+        if (hayTrabajo) {
+            for (int i = 0; i < numNucleos; i++) {
+                if (i != actual && nucleos[i].inactivo && nucleos[i].tiempoLibre > tiempo) {
+                    nucleos[i].tiempoLibre = tiempo;
+                }
+            }
+        }
+    }
+
+    calcularMetricas();
+
+    if (modoDebug) {
+        mostrarResultados();
+    }
+}
+
+/**
+ * Encola en algún núcleo los procesos que ya llegaron
+ */
+void PlanificadorMulticore::procesarLlegadas(int tiempo) {
+    while (siguienteLlegada < static_cast<int>(procesos.size()) &&
+           procesos[siguienteLlegada]->getArrivalTime() <= tiempo) {
+        Proceso* proceso = procesos[siguienteLlegada++];
+
+        int nivelInicial = proceso->getQueueLevel() - 1;
+        if (nivelInicial < 0 || nivelInicial >= static_cast<int>(configuracion.size())) {
+            continue;
+        }
+
+        int destino = elegirNucleo(proceso);
+        nucleos[destino].colas[nivelInicial]->agregarProceso(proceso);
+        avisarProfundidad(destino, nivelInicial, tiempo);
+
+        if (modoDebug) {
+            std::cout << "[t=" << tiempo << "] Proceso " << proceso->getEtiqueta()
+                      << " llega al núcleo " << destino << ", cola " << (nivelInicial + 1) << std::endl;
+        }
+    }
+}
+
+/**
+ * Aplica la política de ubicación inicial
+ */
+int PlanificadorMulticore::elegirNucleo(const Proceso* proceso) {
+    switch (politica) {
+        case PoliticaUbicacion::ROUND_ROBIN: {
+            int destino = siguienteNucleoRR;
+            siguienteNucleoRR = (siguienteNucleoRR + 1) % numNucleos;
+            return destino;
+        }
+        case PoliticaUbicacion::AFINIDAD: {
+            // Hash FNV-1a de la etiqueta: el mismo proceso siempre cae en el mismo núcleo
+            unsigned int hash = 2166136261u;
+            for (char c : proceso->getEtiqueta()) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+            }
+            return static_cast<int>(hash % static_cast<unsigned int>(numNucleos));
+        }
+        case PoliticaUbicacion::MENOS_CARGADO:
+        default: {
+            int destino = 0;
+            int menorCarga = INT_MAX;
+            for (int i = 0; i < numNucleos; i++) {
+                int carga = procesosEncolados(i) + (nucleos[i].inactivo ? 0 : 1);
+                if (carga < menorCarga) {
+                    menorCarga = carga;
+                    destino = i;
+                }
+            }
+            return destino;
+        }
+    }
+}
+
+int PlanificadorMulticore::procesosEncolados(int nucleo) const {
+    int total = 0;
+    for (const Cola* cola : nucleos[nucleo].colas) {
+        total += static_cast<int>(cola->size());
+    }
+    return total;
+}
+
+/**
+ * Toma el proceso de mayor prioridad de las colas propias del núcleo
+ */
+Proceso* PlanificadorMulticore::tomarProcesoLocal(int nucleo, int tiempo) {
+    std::vector<Cola*>& colas = nucleos[nucleo].colas;
+    for (size_t nivel = 0; nivel < colas.size(); nivel++) {
+        if (!colas[nivel]->isEmpty()) {
+            Proceso* proceso = colas[nivel]->obtenerSiguienteProceso();
+            avisarProfundidad(nucleo, static_cast<int>(nivel), tiempo);
+            return proceso;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Roba un proceso de la cola de menor prioridad no vacía del núcleo más cargado
+ */
+Proceso* PlanificadorMulticore::robarProceso(int nucleo, int tiempo) {
+    int victima = -1;
+    int mayorCarga = 0;
+    for (int i = 0; i < numNucleos; i++) {
+        if (i == nucleo) continue;
+        int carga = procesosEncolados(i);
+        if (carga > mayorCarga) {
+            mayorCarga = carga;
+            victima = i;
+        }
+    }
+    if (victima < 0) return nullptr;
+
+    std::vector<Cola*>& colas = nucleos[victima].colas;
+    for (int nivel = static_cast<int>(colas.size()) - 1; nivel >= 0; nivel--) {
+        if (!colas[nivel]->isEmpty()) {
+            Proceso* proceso = colas[nivel]->obtenerSiguienteProceso();
+            avisarProfundidad(victima, nivel, tiempo);
+            estadisticas[nucleo].robos++;
+
+            if (modoDebug) {
+                std::cout << "Núcleo " << nucleo << " roba " << proceso->getEtiqueta()
+                          << " del núcleo " << victima << " (cola " << (nivel + 1) << ")" << std::endl;
+            }
+            return proceso;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Cierra el intervalo en curso del núcleo: completa el proceso o lo degrada
+ * a la siguiente cola del propio núcleo
+ */
+void PlanificadorMulticore::finalizarIntervalo(int nucleo) {
+    Proceso* proceso = nucleos[nucleo].enEjecucion;
+    if (proceso == nullptr) return;
+    nucleos[nucleo].enEjecucion = nullptr;
+
+    if (proceso->getIsCompleted()) {
+        proceso->setCompletionTime(nucleos[nucleo].tiempoLibre);
+        makespan = std::max(makespan, nucleos[nucleo].tiempoLibre);
+        if (observador != nullptr) {
+            observador->procesoCompletadoNucleo(nucleo, proceso);
+        }
+        return;
+    }
+
+    std::vector<Cola*>& colas = nucleos[nucleo].colas;
+    int nivelActual = proceso->getCurrentQueueLevel() - 1;
+    int siguienteNivel = nivelActual + 1;
+
+    if (siguienteNivel < static_cast<int>(colas.size())) {
+        colas[siguienteNivel]->agregarProceso(proceso);
+        avisarProfundidad(nucleo, siguienteNivel, nucleos[nucleo].tiempoLibre);
+    } else {
+        colas[nivelActual]->devolverProceso(proceso);
+        avisarProfundidad(nucleo, nivelActual, nucleos[nucleo].tiempoLibre);
+    }
+}
+
+/**
+ * Ejecuta un intervalo de un proceso en el núcleo indicado
+ */
+void PlanificadorMulticore::despachar(int nucleo, Proceso* proceso, int tiempo, bool migrado) {
+    int inicio = tiempo;
+    if (migrado) {
+        inicio += costoMigracion;
+        estadisticas[nucleo].tiempoMigracion += costoMigracion;
+    }
+
+    if (!proceso->getHasStarted()) {
+        proceso->setResponseTime(inicio - proceso->getArrivalTime());
+    }
+
+    const Cola* cola = nucleos[nucleo].colas[proceso->getCurrentQueueLevel() - 1];
+    int tiempoEjecucion = proceso->getBurstTimeRestante();
+    if (cola->getAlgoritmo() == TipoAlgoritmo::ROUND_ROBIN) {
+        tiempoEjecucion = std::min(cola->getQuantum(), tiempoEjecucion);
+    }
+    proceso->ejecutar(tiempoEjecucion);
+
+    nucleos[nucleo].enEjecucion = proceso;
+    nucleos[nucleo].inactivo = false;
+    nucleos[nucleo].tiempoLibre = inicio + tiempoEjecucion;
+    estadisticas[nucleo].tiempoOcupado += tiempoEjecucion;
+    estadisticas[nucleo].despachos++;
+
+    RegistroEjecucionNucleo registro;
+    registro.nucleo = nucleo;
+    registro.migrado = migrado;
+    registro.registro.etiquetaProceso = proceso->getEtiqueta();
+    registro.registro.tiempoInicio = inicio;
+    registro.registro.tiempoFin = inicio + tiempoEjecucion;
+    registro.registro.nivelCola = proceso->getCurrentQueueLevel();
+    registro.registro.algoritmo = cola->obtenerNombreAlgoritmo();
+    historialEjecucion.push_back(registro);
+
+    // El intervalo queda decidido al despacharlo (no se fusiona con otros)
+    if (observador != nullptr) {
+        observador->registroCerradoNucleo(nucleo, registro.registro);
+    }
+}
+
+/**
+ * Próximo instante en que un núcleo ocioso puede encontrar trabajo:
+ * la siguiente llegada o el fin de un intervalo en otro núcleo
+ */
+int PlanificadorMulticore::siguienteEvento(int nucleo, int tiempo) const {
+    int evento = INT_MAX;
+    if (siguienteLlegada < static_cast<int>(procesos.size())) {
+        evento = std::max(tiempo, procesos[siguienteLlegada]->getArrivalTime());
+    }
+    for (int i = 0; i < numNucleos; i++) {
+        if (i != nucleo && !nucleos[i].inactivo && nucleos[i].tiempoLibre >= tiempo) {
+            evento = std::min(evento, nucleos[i].tiempoLibre);
+        }
+    }
+    return evento;
+}
+
+void PlanificadorMulticore::avisarProfundidad(int nucleo, int indiceNivel, int tiempo) {
+    if (observador != nullptr) {
+        observador->profundidadColaNucleo(tiempo, nucleo, indiceNivel + 1,
+                                          static_cast<int>(nucleos[nucleo].colas[indiceNivel]->size()));
+    }
+}
+
+/**
+ * Calcula promedios, utilización por núcleo y desbalance de carga
+ */
+void PlanificadorMulticore::calcularMetricas() {
+    if (procesos.empty()) return;
+
+    // TAT/WT y sumas con los mismos kernels vectorizados del motor de un núcleo
+    size_t numProcesos = procesos.size();
+    ArreglosMetricas metricas;
+    metricas.redimensionar(numProcesos);
+    for (size_t i = 0; i < numProcesos; i++) {
+        metricas.burst[i] = procesos[i]->getBurstTime();
+        metricas.llegada[i] = procesos[i]->getArrivalTime();
+        metricas.completado[i] = procesos[i]->getCompletionTime();
+        metricas.respuesta[i] = procesos[i]->getResponseTime();
+    }
+    KernelsMetricas::calcularTiempos(metricas);
+    for (size_t i = 0; i < numProcesos; i++) {
+        if (metricas.completado[i] > 0) {
+            procesos[i]->setTurnaroundTime(metricas.retorno[i]);
+            procesos[i]->setWaitingTime(metricas.espera[i]);
+        }
+    }
+
+    EstadisticasMetricas resumen = KernelsMetricas::calcularEstadisticas(metricas);
+    double n = static_cast<double>(numProcesos);
+    promedioWT = resumen.wt.suma / n;
+    promedioCT = resumen.ct.suma / n;
+    promedioRT = resumen.rt.suma / n;
+    promedioTAT = resumen.tat.suma / n;
+
+    // Desbalance: (carga máxima / carga media) - 1
+    long long cargaMaxima = 0, cargaTotal = 0;
+    for (EstadisticasNucleo& estadistica : estadisticas) {
+        estadistica.utilizacion = makespan > 0
+            ? static_cast<double>(estadistica.tiempoOcupado) / makespan : 0.0;
+        cargaMaxima = std::max(cargaMaxima, estadistica.tiempoOcupado);
+        cargaTotal += estadistica.tiempoOcupado;
+    }
+    double cargaMedia = static_cast<double>(cargaTotal) / numNucleos;
+    desbalanceCarga = cargaMedia > 0 ? cargaMaxima / cargaMedia - 1.0 : 0.0;
+}
+
+/**
+ * Muestra los resultados de la simulación multinúcleo
+ */
+void PlanificadorMulticore::mostrarResultados() const {
+    std::cout << "\n=== RESULTADOS DE LA SIMULACIÓN MULTINÚCLEO ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Núcleos: " << numNucleos << "  Política: " << nombrePolitica(politica)
+              << "  Costo de migración: " << costoMigracion << std::endl;
+
+    std::cout << "\nTabla de Procesos:" << std::endl;
+    std::cout << "Etiqueta\tBT\tAT\tQ\tPr\tWT\tCT\tRT\tTAT" << std::endl;
+    std::cout << "------------------------------------------------" << std::endl;
+
+    for (const Proceso* proceso : procesos) {
+        std::cout << proceso->getEtiqueta() << "\t\t"
+                  << proceso->getBurstTime() << "\t"
+                  << proceso->getArrivalTime() << "\t"
+                  << proceso->getQueueLevel() << "\t"
+                  << proceso->getPriority() << "\t"
+                  << proceso->getWaitingTime() << "\t"
+                  << proceso->getCompletionTime() << "\t"
+                  << proceso->getResponseTime() << "\t"
+                  << proceso->getTurnaroundTime() << std::endl;
+    }
+
+    std::cout << "\nNúcleo\tOcupado\tMigración\tDespachos\tRobos\tUtilización" << std::endl;
+    for (int i = 0; i < numNucleos; i++) {
+        const EstadisticasNucleo& e = estadisticas[i];
+        std::cout << i << "\t" << e.tiempoOcupado << "\t" << e.tiempoMigracion << "\t\t"
+                  << e.despachos << "\t\t" << e.robos << "\t"
+                  << (e.utilizacion * 100.0) << "%" << std::endl;
+    }
+
+    std::cout << "\n=== PROMEDIOS ===" << std::endl;
+    std::cout << "Waiting Time (WT): " << promedioWT << std::endl;
+    std::cout << "Completion Time (CT): " << promedioCT << std::endl;
+    std::cout << "Response Time (RT): " << promedioRT << std::endl;
+    std::cout << "Turnaround Time (TAT): " << promedioTAT << std::endl;
+    std::cout << "Makespan: " << makespan << std::endl;
+    std::cout << "Desbalance de carga: " << (desbalanceCarga * 100.0) << "%" << std::endl;
+}
+
+// Getters
+int PlanificadorMulticore::getNumNucleos() const { return numNucleos; }
+int PlanificadorMulticore::getMakespan() const { return makespan; }
+double PlanificadorMulticore::getPromedioWT() const { return promedioWT; }
+double PlanificadorMulticore::getPromedioCT() const { return promedioCT; }
+double PlanificadorMulticore::getPromedioRT() const { return promedioRT; }
+double PlanificadorMulticore::getPromedioTAT() const { return promedioTAT; }
+double PlanificadorMulticore::getDesbalanceCarga() const { return desbalanceCarga; }
+
+const std::vector<EstadisticasNucleo>& PlanificadorMulticore::getEstadisticasNucleos() const {
+    return estadisticas;
+}
+
+const std::vector<RegistroEjecucionNucleo>& PlanificadorMulticore::getHistorialEjecucion() const {
+    return historialEjecucion;
+}
+
+std::string PlanificadorMulticore::nombrePolitica(PoliticaUbicacion politica) {
+    switch (politica) {
+        case PoliticaUbicacion::ROUND_ROBIN:
+            return "ROUND_ROBIN";
+        case PoliticaUbicacion::MENOS_CARGADO:
+            return "MENOS_CARGADO";
+        case PoliticaUbicacion::AFINIDAD:
+            return "AFINIDAD";
+        default:
+            return "UNKNOWN";
+    }
+}
@@ -0,0 +1,123 @@
+#ifndef PLANIFICADOR_MULTICORE_H
+#define PLANIFICADOR_MULTICORE_H
+
+#include <vector>
+#include <string>
+#include "Proceso.h"
+#include "Cola.h"
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Política para decidir en qué núcleo se encola un proceso al llegar
+ */
+enum class PoliticaUbicacion {
+    ROUND_ROBIN,    // Reparte las llegadas de forma circular entre los núcleos
+    MENOS_CARGADO,  // Núcleo con menos procesos encolados
+    AFINIDAD        // Núcleo fijo según la etiqueta del proceso
+};
+
+/**
+ * Registro de ejecución con el núcleo donde se ejecutó el intervalo
+ */
+struct RegistroEjecucionNucleo {
+    int nucleo;
+    RegistroEjecucion registro;
+    bool migrado;   // El proceso fue robado de otro núcleo para este intervalo
+};
+
+/**
+ * Estadísticas acumuladas por núcleo
+ */
+struct EstadisticasNucleo {
+    long long tiempoOcupado;    // Tiempo ejecutando procesos
+    long long tiempoMigracion;  // Tiempo perdido migrando procesos robados
+    int despachos;              // Intervalos ejecutados
+    int robos;                  // Procesos robados a otros núcleos
+    double utilizacion;         // tiempoOcupado / makespan
+};
+
+/**
+ * Simulador MLFQ de N núcleos: cada núcleo tiene su propio juego de colas
+ * y los núcleos ociosos roban trabajo de la cola de menor prioridad del
+ * núcleo más cargado.
+ *
+ * Solo admite procesos de una ráfaga de CPU: ejecutarSimulacion() rechaza las
+ * cargas con E/S (esMultirafaga()) en lugar de ignorar los bloqueos.
+ */
+class PlanificadorMulticore {
+private:
+    // Estado de simulación de cada núcleo
+    struct EstadoNucleo {
+        std::vector<Cola*> colas;   // Colas propias ordenadas por prioridad
+        int tiempoLibre;            // Instante del próximo evento del núcleo
+        Proceso* enEjecucion;       // Proceso cuyo intervalo termina en tiempoLibre
+        bool inactivo;              // No tiene proceso asignado
+    };
+
+    int numNucleos;
+    std::vector<EstadoNucleo> nucleos;
+    std::vector<EstadisticasNucleo> estadisticas;
+    std::vector<ConfiguracionCola> configuracion;
+    std::vector<Proceso*> procesos;                     // Lista de todos los procesos
+    std::vector<RegistroEjecucionNucleo> historialEjecucion;
+
+    PoliticaUbicacion politica;
+    int costoMigracion;                                 // Tiempo que cuesta migrar un proceso
+    int siguienteLlegada;                               // Índice del próximo proceso por llegar
+    int siguienteNucleoRR;                              // Turno para la política ROUND_ROBIN
+    int makespan;                                       // Instante en que termina el último proceso
+    bool modoDebug;
+    ObservadorEjecucion* observador;                    // Receptor de eventos por núcleo (opcional)
+
+    // Métricas calculadas
+    double promedioWT;
+    double promedioCT;
+    double promedioRT;
+    double promedioTAT;
+    double desbalanceCarga;
+
+    // Pasos internos de la simulación
+    void procesarLlegadas(int tiempo);
+    int elegirNucleo(const Proceso* proceso);
+    int procesosEncolados(int nucleo) const;
+    Proceso* tomarProcesoLocal(int nucleo, int tiempo);
+    Proceso* robarProceso(int nucleo, int tiempo);
+    void finalizarIntervalo(int nucleo);
+    void despachar(int nucleo, Proceso* proceso, int tiempo, bool migrado);
+    int siguienteEvento(int nucleo, int tiempo) const;
+    void avisarProfundidad(int nucleo, int indiceNivel, int tiempo);
+    void liberarColas();
+
+public:
+    // Constructor y destructor
+    PlanificadorMulticore(int numNucleos, bool debug = false);
+    ~PlanificadorMulticore();
+
+    // Configuración del planificador
+    void configurarColas(const std::vector<ConfiguracionCola>& configuraciones);
+    void setPoliticaUbicacion(PoliticaUbicacion politica);
+    void setCostoMigracion(int costo);
+    void setObservador(ObservadorEjecucion* observadorEjecucion);
+    void agregarProceso(Proceso* proceso);
+    void limpiarProcesos();
+
+    // Simulación
+    void ejecutarSimulacion();
+    void calcularMetricas();
+    void mostrarResultados() const;
+
+    // Getters
+    int getNumNucleos() const;
+    int getMakespan() const;
+    double getPromedioWT() const;
+    double getPromedioCT() const;
+    double getPromedioRT() const;
+    double getPromedioTAT() const;
+    double getDesbalanceCarga() const;
+    const std::vector<EstadisticasNucleo>& getEstadisticasNucleos() const;
+    const std::vector<RegistroEjecucionNucleo>& getHistorialEjecucion() const;
+
+    static std::string nombrePolitica(PoliticaUbicacion politica);
+};
+
+#endif // PLANIFICADOR_MULTICORE_H
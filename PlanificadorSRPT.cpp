@@ -0,0 +1,137 @@
+#include "PlanificadorSRPT.h"
+#include "KernelsMetricas.h"
+#include "OrdenLlegadas.h"
+#include <queue>
+#include <climits>
+#include <algorithm>
+
+namespace {
+
+struct Evento {
+    long long clave;    // CPU restante (listos) o instante de despertar (en E/S)
+    size_t orden;       // Posición en el orden de llegada: desempata en FIFO
+    Proceso* proceso;
+
+    bool operator>(const Evento& otro) const {
+        return clave != otro.clave ? clave > otro.clave : orden > otro.orden;
+    }
+};
+
+typedef std::priority_queue<Evento, std::vector<Evento>, std::greater<Evento>> MonticuloMinimo;
+
+} // namespace
+
+PlanificadorSRPT::PlanificadorSRPT()
+    : promedioWT(0), promedioCT(0), promedioRT(0), promedioTAT(0) {}
+
+void PlanificadorSRPT::agregarProceso(Proceso* proceso) {
+    if (proceso != nullptr) {
+        procesos.push_back(proceso);
+    }
+}
+
+/**
+ * Ejecuta el proceso con menos CPU restante hasta que termine su ráfaga o
+ * llegue el próximo evento, que puede desplazarlo
+ */
+void PlanificadorSRPT::ejecutarSimulacion() {
+    std::vector<Proceso*> llegadas = procesos;
+    OrdenLlegadas::ordenarEstable(llegadas);
+    for (Proceso* proceso : llegadas) {
+        proceso->reset();
+    }
+
+    MonticuloMinimo listos;
+    MonticuloMinimo enES;
+    size_t siguiente = 0;
+    size_t pendientes = llegadas.size();
+    long long tiempo = 0;
+
+    while (pendientes > 0) {
+        while (siguiente < llegadas.size() && llegadas[siguiente]->getArrivalTime() <= tiempo) {
+            Proceso* proceso = llegadas[siguiente];
+            listos.push(Evento{proceso->getBurstTimeRestante(), siguiente, proceso});
+            siguiente++;
+        }
+        while (!enES.empty() && enES.top().clave <= tiempo) {
+            Evento despertar = enES.top();
+            enES.pop();
+            listos.push(Evento{despertar.proceso->getBurstTimeRestante(), despertar.orden, despertar.proceso});
+        }
+
+        long long proximo = LLONG_MAX;
+        if (siguiente < llegadas.size()) {
+            proximo = llegadas[siguiente]->getArrivalTime();
+        }
+        if (!enES.empty()) {
+            proximo = std::min(proximo, enES.top().clave);
+        }
+
+        if (listos.empty()) {
+            tiempo = proximo;   // CPU ociosa hasta la próxima llegada o fin de E/S
+            continue;
+        }
+
+        Evento actual = listos.top();
+        listos.pop();
+        Proceso* proceso = actual.proceso;
+        if (!proceso->getHasStarted()) {
+            proceso->setResponseTime(static_cast<int>(tiempo - proceso->getArrivalTime()));
+        }
+
+        long long tramo = proceso->getRafagaCPURestante();
+        if (proximo != LLONG_MAX) {
+            tramo = std::min(tramo, proximo - tiempo);
+        }
+        proceso->ejecutar(static_cast<int>(tramo));
+        tiempo += tramo;
+
+        if (proceso->getIsCompleted()) {
+            proceso->setCompletionTime(static_cast<int>(tiempo));
+            pendientes--;
+        } else if (proceso->rafagaCPUTerminada()) {
+            int duracion = proceso->iniciarES();
+            enES.push(Evento{tiempo + duracion, actual.orden, proceso});
+        } else {
+            listos.push(Evento{proceso->getBurstTimeRestante(), actual.orden, proceso});
+        }
+    }
+
+    calcularMetricas();
+}
+
+/**
+ * TAT/WT y promedios con los mismos kernels que el MLFQ (WT descuenta la E/S)
+ */
+void PlanificadorSRPT::calcularMetricas() {
+    if (procesos.empty()) return;
+
+    size_t numProcesos = procesos.size();
+    ArreglosMetricas metricas;
+    metricas.redimensionar(numProcesos);
+    for (size_t i = 0; i < numProcesos; i++) {
+        metricas.burst[i] = procesos[i]->getBurstTime() + procesos[i]->getTiempoES();
+        metricas.llegada[i] = procesos[i]->getArrivalTime();
+        metricas.completado[i] = procesos[i]->getCompletionTime();
+        metricas.respuesta[i] = procesos[i]->getResponseTime();
+    }
+    KernelsMetricas::calcularTiempos(metricas);
+    for (size_t i = 0; i < numProcesos; i++) {
+        if (metricas.completado[i] > 0) {
+            procesos[i]->setTurnaroundTime(metricas.retorno[i]);
+            procesos[i]->setWaitingTime(metricas.espera[i]);
+        }
+    }
+
+    EstadisticasMetricas resumen = KernelsMetricas::calcularEstadisticas(metricas);
+    double n = static_cast<double>(numProcesos);
+    promedioWT = static_cast<double>(resumen.wt.suma) / n;
+    promedioCT = static_cast<double>(resumen.ct.suma) / n;
+    promedioRT = static_cast<double>(resumen.rt.suma) / n;
+    promedioTAT = static_cast<double>(resumen.tat.suma) / n;
+}
+
+double PlanificadorSRPT::getPromedioWT() const { return promedioWT; }
+double PlanificadorSRPT::getPromedioCT() const { return promedioCT; }
+double PlanificadorSRPT::getPromedioRT() const { return promedioRT; }
+double PlanificadorSRPT::getPromedioTAT() const { return promedioTAT; }
@@ -0,0 +1,43 @@
+#ifndef PLANIFICADOR_SRPT_H
+#define PLANIFICADOR_SRPT_H
+
+#include <vector>
+#include "Proceso.h"
+
+/**
+ * Referencia Shortest Remaining Processing Time de una CPU
+ *
+ * Siempre ejecuta el proceso listo con menos CPU restante y lo reevalúa en
+ * cada llegada. Sin E/S es la política con menor TAT (y WT) medio posible en
+ * una CPU, así que sirve de cota para comparar cualquier configuración del
+ * MLFQ sobre la misma carga. Los procesos con E/S se bloquean al terminar
+ * cada ráfaga como en el MLFQ; con ellos la referencia deja de ser una cota
+ * estricta.
+ *
+ * Cada evento (llegada, fin de ráfaga o de E/S) cuesta un par de operaciones
+ * de montículo: O(n log n) para n procesos de una ráfaga. No guarda historial.
+ */
+class PlanificadorSRPT {
+private:
+    std::vector<Proceso*> procesos;     // No se liberan: son del llamador
+
+    double promedioWT;
+    double promedioCT;
+    double promedioRT;
+    double promedioTAT;
+
+    void calcularMetricas();
+
+public:
+    PlanificadorSRPT();
+
+    void agregarProceso(Proceso* proceso);
+    void ejecutarSimulacion();
+
+    double getPromedioWT() const;
+    double getPromedioCT() const;
+    double getPromedioRT() const;
+    double getPromedioTAT() const;
+};
+
+#endif // PLANIFICADOR_SRPT_H
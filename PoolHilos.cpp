@@ -0,0 +1,131 @@
+#include "PoolHilos.h"
+
+/**
+ * Constructor: lanza los hilos trabajadores
+ */
+PoolHilos::PoolHilos(int numHilos)
+    : siguienteCola(0), pendientes(0), detener(false) {
+    if (numHilos <= 0) {
+        numHilos = hilosPorDefecto();
+    }
+
+    for (int i = 0; i < numHilos; i++) {
+        colas.push_back(new ColaTrabajo());
+    }
+    for (int i = 0; i < numHilos; i++) {
+        hilos.push_back(std::thread(&PoolHilos::bucleTrabajador, this, static_cast<size_t>(i)));
+    }
+}
+
+/**
+ * Destructor: espera las tareas pendientes y detiene los hilos
+ */
+PoolHilos::~PoolHilos() {
+    esperar();
+    {
+        std::lock_guard<std::mutex> lock(mutexEspera);
+        detener = true;
+    }
+    hayTrabajo.notify_all();
+
+    for (std::thread& hilo : hilos) {
+        hilo.join();
+    }
+    for (ColaTrabajo* cola : colas) {
+        delete cola;
+    }
+}
+
+/**
+ * Encola una tarea en la cola del siguiente hilo (reparto circular)
+ */
+void PoolHilos::enviar(std::function<void()> tarea) {
+    size_t destino = siguienteCola++ % colas.size();
+    pendientes++;
+    {
+        std::lock_guard<std::mutex> lock(colas[destino]->mutex);
+        colas[destino]->tareas.push_back(std::move(tarea));
+    }
+    {
+        // Tomar el mutex evita perder la notificación de un hilo que está por dormir
+        std::lock_guard<std::mutex> lock(mutexEspera);
+    }
+    hayTrabajo.notify_one();
+}
+
+/**
+ * Bloquea hasta que todas las tareas enviadas hayan terminado
+ */
+void PoolHilos::esperar() {
+    std::unique_lock<std::mutex> lock(mutexEspera);
+    todoTerminado.wait(lock, [this]() { return pendientes.load() == 0; });
+}
+
+int PoolHilos::getNumHilos() const {
+    return static_cast<int>(hilos.size());
+}
+
+int PoolHilos::hilosPorDefecto() {
+    unsigned int disponibles = std::thread::hardware_concurrency();
+    return disponibles > 0 ? static_cast<int>(disponibles) : 1;
+}
+
+/**
+ * Toma una tarea de la cola propia o, si está vacía, roba una de otro hilo
+ */
+bool PoolHilos::obtenerTarea(size_t indice, std::function<void()>& tarea) {
+    {
+        ColaTrabajo* propia = colas[indice];
+        std::lock_guard<std::mutex> lock(propia->mutex);
+        if (!propia->tareas.empty()) {
+            tarea = std::move(propia->tareas.back());
+            propia->tareas.pop_back();
+            return true;
+        }
+    }
+
+    for (size_t paso = 1; paso < colas.size(); paso++) {
+        ColaTrabajo* victima = colas[(indice + paso) % colas.size()];
+        std::lock_guard<std::mutex> lock(victima->mutex);
+        if (!victima->tareas.empty()) {
+            tarea = std::move(victima->tareas.front());
+            victima->tareas.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Bucle de cada hilo: ejecuta tareas mientras haya y duerme cuando no
+ */
+void PoolHilos::bucleTrabajador(size_t indice) {
+    while (true) {
+        std::function<void()> tarea;
+        if (obtenerTarea(indice, tarea)) {
+            tarea();
+            if (--pendientes == 0) {
+                std::lock_guard<std::mutex> lock(mutexEspera);
+                todoTerminado.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutexEspera);
+        if (detener) {
+            return;
+        }
+        // Volver a intentar si llegó trabajo entre la búsqueda y el bloqueo
+        hayTrabajo.wait(lock, [this]() {
+            if (detener) return true;
+            for (ColaTrabajo* cola : colas) {
+                std::lock_guard<std::mutex> lockCola(cola->mutex);
+                if (!cola->tareas.empty()) return true;
+            }
+            return false;
+        });
+        if (detener) {
+            return;
+        }
+    }
+}
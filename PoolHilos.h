@@ -0,0 +1,55 @@
+#ifndef POOL_HILOS_H
+#define POOL_HILOS_H
+
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/**
+ * Pool de hilos con robo de trabajo
+ *
+ * Cada hilo tiene su propia cola de tareas: toma de su final (LIFO, mejor
+ * localidad) y, cuando se queda sin trabajo, roba del frente de la cola de
+ * otro hilo. Las tareas enviadas desde fuera se reparten de forma circular.
+ */
+class PoolHilos {
+private:
+    struct ColaTrabajo {
+        std::deque<std::function<void()>> tareas;
+        std::mutex mutex;
+    };
+
+    std::vector<std::thread> hilos;
+    std::vector<ColaTrabajo*> colas;          // Una cola por hilo
+    std::atomic<size_t> siguienteCola;        // Reparto circular de tareas externas
+    std::atomic<int> pendientes;              // Tareas enviadas y no terminadas
+    std::atomic<bool> detener;
+
+    std::mutex mutexEspera;
+    std::condition_variable hayTrabajo;       // Despierta hilos ociosos
+    std::condition_variable todoTerminado;    // Despierta a esperar()
+
+    void bucleTrabajador(size_t indice);
+    bool obtenerTarea(size_t indice, std::function<void()>& tarea);
+
+public:
+    // Constructor y destructor
+    explicit PoolHilos(int numHilos = 0);     // 0 = hardware_concurrency
+    ~PoolHilos();
+
+    // No copiable
+    PoolHilos(const PoolHilos&) = delete;
+    PoolHilos& operator=(const PoolHilos&) = delete;
+
+    void enviar(std::function<void()> tarea);
+    void esperar();                           // Bloquea hasta que no queden tareas
+    int getNumHilos() const;
+
+    static int hilosPorDefecto();
+};
+
+#endif // POOL_HILOS_H
@@ -1,4 +1,5 @@
 #include "Proceso.h"
+#include <algorithm>
 
 /**
  * Constructor de la clase Proceso
@@ -8,7 +9,29 @@ Proceso::Proceso(const std::string& etiqueta, int burstTime, int arrivalTime,
     : etiqueta(etiqueta), burstTime(burstTime), burstTimeRestante(burstTime),
       arrivalTime(arrivalTime), queueLevel(queueLevel), priority(priority),
       waitingTime(0), completionTime(0), responseTime(-1), turnaroundTime(0),
-      hasStarted(false), isCompleted(false), currentQueueLevel(queueLevel) {
+      hasStarted(false), isCompleted(false), currentQueueLevel(queueLevel), ultimaEjecucion(-1),
+      indiceRafaga(0), rafagaRestante(0), tiempoES(0) {
+}
+
+/**
+ * Constructor para procesos que alternan CPU y E/S. El burst time es la suma
+ * de las ráfagas de CPU; con una sola ráfaga equivale al constructor habitual.
+ */
+Proceso::Proceso(const std::string& etiqueta, const std::vector<int>& listaRafagas, int arrivalTime,
+                 int queueLevel, int priority)
+    : Proceso(etiqueta, 0, arrivalTime, queueLevel, priority) {
+    for (size_t i = 0; i < listaRafagas.size(); i++) {
+        if (i % 2 == 0) {
+            burstTime += listaRafagas[i];
+        } else {
+            tiempoES += listaRafagas[i];
+        }
+    }
+    burstTimeRestante = burstTime;
+    if (listaRafagas.size() > 1) {
+        rafagas = listaRafagas;
+        rafagaRestante = rafagas[0];
+    }
 }
 
 // Getters
@@ -64,6 +87,30 @@ int Proceso::getCurrentQueueLevel() const {
     return currentQueueLevel;
 }
 
+int Proceso::getUltimaEjecucion() const {
+    return ultimaEjecucion;
+}
+
+const std::vector<int>& Proceso::getRafagas() const {
+    return rafagas;
+}
+
+bool Proceso::esMultirafaga() const {
+    return !rafagas.empty();
+}
+
+int Proceso::getIndiceRafaga() const {
+    return indiceRafaga;
+}
+
+int Proceso::getRafagaCPURestante() const {
+    return rafagas.empty() ? burstTimeRestante : rafagaRestante;
+}
+
+int Proceso::getTiempoES() const {
+    return tiempoES;
+}
+
 // Setters
 void Proceso::setBurstTimeRestante(int tiempo) {
     burstTimeRestante = tiempo;
@@ -97,6 +144,15 @@ void Proceso::setCurrentQueueLevel(int level) {
     currentQueueLevel = level;
 }
 
+void Proceso::setUltimaEjecucion(int tiempo) {
+    ultimaEjecucion = tiempo;
+}
+
+void Proceso::setEstadoRafaga(int indice, int restante) {
+    indiceRafaga = indice;
+    rafagaRestante = restante;
+}
+
 /**
  * Ejecuta el proceso por un tiempo determinado
  * @param tiempoEjecucion: tiempo que se va a ejecutar el proceso
@@ -107,6 +163,9 @@ void Proceso::ejecutar(int tiempoEjecucion) {
     }
     
     burstTimeRestante -= tiempoEjecucion;
+    if (!rafagas.empty()) {
+        rafagaRestante = std::max(0, rafagaRestante - tiempoEjecucion);
+    }
     
     if (burstTimeRestante <= 0) {
         burstTimeRestante = 0;
@@ -120,7 +179,7 @@ void Proceso::ejecutar(int tiempoEjecucion) {
 void Proceso::calcularTiempos() {
     if (completionTime > 0) {
         turnaroundTime = completionTime - arrivalTime;
-        waitingTime = turnaroundTime - burstTime;
+        waitingTime = turnaroundTime - burstTime - tiempoES;
     }
 }
 
@@ -136,6 +195,27 @@ void Proceso::reset() {
     hasStarted = false;
     isCompleted = false;
     currentQueueLevel = queueLevel;
+    ultimaEjecucion = -1;
+    indiceRafaga = 0;
+    rafagaRestante = rafagas.empty() ? 0 : rafagas[0];
+}
+
+bool Proceso::rafagaCPUTerminada() const {
+    return !rafagas.empty() && !isCompleted && rafagaRestante == 0;
+}
+
+/**
+ * Avanza a la siguiente ráfaga de CPU
+ * @return duración de la ráfaga de E/S intermedia (0 si no hay más ráfagas)
+ */
+int Proceso::iniciarES() {
+    if (indiceRafaga + 2 >= static_cast<int>(rafagas.size())) {
+        return 0;
+    }
+    int duracion = rafagas[indiceRafaga + 1];
+    indiceRafaga += 2;
+    rafagaRestante = rafagas[indiceRafaga];
+    return duracion;
 }
 
 /**
@@ -2,6 +2,7 @@
 #define PROCESO_H
 
 #include <string>
+#include <vector>
 
 /**
  * Clase que representa un proceso en el sistema de planificación MLFQ
@@ -25,12 +26,23 @@ private:
     bool hasStarted;                // Si el proceso ya ha comenzado su ejecución
     bool isCompleted;               // Si el proceso ha terminado
     int currentQueueLevel;          // Nivel de cola actual (puede cambiar)
+    int ultimaEjecucion;            // Fin de su último intervalo en CPU (-1 si no ha ejecutado)
+    
+    // Ráfagas alternadas CPU, E/S, CPU, ... (vacío: una sola ráfaga de CPU)
+    std::vector<int> rafagas;
+    int indiceRafaga;               // Ráfaga de CPU en curso (índice par en rafagas)
+    int rafagaRestante;             // Tiempo restante de la ráfaga de CPU en curso
+    int tiempoES;                   // Suma de las ráfagas de E/S
 
 public:
     // Constructor
     Proceso(const std::string& etiqueta, int burstTime, int arrivalTime, 
             int queueLevel, int priority);
     
+    // Constructor con ráfagas alternadas CPU/E/S (cantidad impar, empieza y termina en CPU)
+    Proceso(const std::string& etiqueta, const std::vector<int>& rafagas, int arrivalTime,
+            int queueLevel, int priority);
+    
     // Getters
     std::string getEtiqueta() const;
     int getBurstTime() const;
@@ -45,6 +57,12 @@ public:
     bool getHasStarted() const;
     bool getIsCompleted() const;
     int getCurrentQueueLevel() const;
+    int getUltimaEjecucion() const;
+    const std::vector<int>& getRafagas() const;
+    bool esMultirafaga() const;
+    int getIndiceRafaga() const;
+    int getRafagaCPURestante() const;   // Sin ráfagas de E/S coincide con getBurstTimeRestante
+    int getTiempoES() const;
     
     // Setters
     void setBurstTimeRestante(int tiempo);
@@ -55,11 +73,15 @@ public:
     void setHasStarted(bool started);
     void setIsCompleted(bool completed);
     void setCurrentQueueLevel(int level);
+    void setUltimaEjecucion(int tiempo);
+    void setEstadoRafaga(int indice, int restante);
     
     // Métodos de utilidad
     void ejecutar(int tiempoEjecucion);  // Ejecuta el proceso por un tiempo dado
     void calcularTiempos();              // Calcula TAT basado en CT y AT
     void reset();                        // Reinicia el proceso para nueva simulación
+    bool rafagaCPUTerminada() const;     // Terminó su ráfaga de CPU y le sigue una de E/S
+    int iniciarES();                     // Pasa a la siguiente ráfaga de CPU; devuelve la duración de la E/S
     
     // Sobrecarga de operadores para comparación (útil para algoritmos SJF/STCF)
     bool operator<(const Proceso& other) const;  // Para SJF
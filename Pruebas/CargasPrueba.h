@@ -0,0 +1,182 @@
+#ifndef CARGAS_PRUEBA_H
+#define CARGAS_PRUEBA_H
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Proceso.h"
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Utilidades comunes de las pruebas de Pruebas/: cargas aleatorias con
+ * semilla y comparación exacta de simulaciones.
+ *
+ * Las cargas tienen muchos empates a propósito (ráfagas de pocos valores
+ * distintos y llegadas simultáneas), que es donde un orden distinto en las
+ * colas SJF/STCF cambia el resultado.
+ */
+namespace CargasPrueba {
+
+/**
+ * Parámetros de una carga aleatoria
+ */
+struct ParametrosCarga {
+    int numProcesos;
+    int separacionMaxima;           // Separación entre llegadas en [0, separacionMaxima]
+    int rafagaMaxima;               // Ráfagas de CPU múltiplos de 2 en [2, rafagaMaxima]
+    int niveles;                    // Nivel inicial en [1, niveles]
+    bool conES;                     // Algunos procesos alternan CPU y E/S
+    int hueco;                      // Cada 8 procesos se suma esta separación (periodos ociosos)
+    
+    ParametrosCarga()
+        : numProcesos(30), separacionMaxima(4), rafagaMaxima(12), niveles(4), conES(false), hueco(0) {}
+};
+
+inline int aleatorio(std::mt19937& generador, int desde, int hasta) {
+    return desde + static_cast<int>(generador() % static_cast<uint32_t>(hasta - desde + 1));
+}
+
+/**
+ * Genera una carga reproducible; el llamador libera los procesos
+ */
+inline std::vector<Proceso*> generarCarga(uint32_t semilla, const ParametrosCarga& parametros) {
+    std::mt19937 generador(semilla);
+    std::vector<Proceso*> procesos;
+    int llegada = 0;
+    
+    for (int i = 0; i < parametros.numProcesos; i++) {
+        llegada += aleatorio(generador, 0, parametros.separacionMaxima);
+        if (i > 0 && i % 8 == 0) {
+            llegada += parametros.hueco;
+        }
+        std::string etiqueta = "P" + std::to_string(i + 1);
+        int nivel = aleatorio(generador, 1, parametros.niveles);
+        int prioridad = aleatorio(generador, 1, 5);
+        
+        if (parametros.conES && aleatorio(generador, 0, 2) == 0) {
+            std::vector<int> rafagas;
+            int numCPU = aleatorio(generador, 2, 3);
+            for (int r = 0; r < numCPU; r++) {
+                if (r > 0) {
+                    rafagas.push_back(aleatorio(generador, 1, 6));
+                }
+                rafagas.push_back(2 * aleatorio(generador, 1, parametros.rafagaMaxima / 2));
+            }
+            procesos.push_back(new Proceso(etiqueta, rafagas, llegada, nivel, prioridad));
+        } else {
+            int rafaga = 2 * aleatorio(generador, 1, parametros.rafagaMaxima / 2);
+            procesos.push_back(new Proceso(etiqueta, rafaga, llegada, nivel, prioridad));
+        }
+    }
+    
+    return procesos;
+}
+
+/**
+ * Copia independiente de una carga sin simular
+ */
+inline std::vector<Proceso*> copiarCarga(const std::vector<Proceso*>& procesos) {
+    std::vector<Proceso*> copia;
+    for (const Proceso* proceso : procesos) {
+        copia.push_back(new Proceso(*proceso));
+    }
+    return copia;
+}
+
+inline void liberarCarga(std::vector<Proceso*>& procesos) {
+    for (Proceso* proceso : procesos) {
+        delete proceso;
+    }
+    procesos.clear();
+}
+
+/**
+ * Compara dos historiales registro a registro
+ * @return false (y describe la primera diferencia) si no son idénticos
+ */
+inline bool mismoHistorial(const std::vector<RegistroEjecucion>& esperado,
+                           const std::vector<RegistroEjecucion>& obtenido,
+                           std::string& diferencia) {
+    size_t comunes = std::min(esperado.size(), obtenido.size());
+    for (size_t i = 0; i < comunes; i++) {
+        const RegistroEjecucion& a = esperado[i];
+        const RegistroEjecucion& b = obtenido[i];
+        if (a.etiquetaProceso != b.etiquetaProceso || a.tiempoInicio != b.tiempoInicio ||
+            a.tiempoFin != b.tiempoFin || a.nivelCola != b.nivelCola || a.algoritmo != b.algoritmo) {
+            diferencia = "registro " + std::to_string(i) + ": " + a.etiquetaProceso + " [" +
+                         std::to_string(a.tiempoInicio) + "," + std::to_string(a.tiempoFin) + ") frente a " +
+                         b.etiquetaProceso + " [" + std::to_string(b.tiempoInicio) + "," +
+                         std::to_string(b.tiempoFin) + ")";
+            return false;
+        }
+    }
+    if (esperado.size() != obtenido.size()) {
+        diferencia = "historial de " + std::to_string(esperado.size()) + " registros frente a " +
+                     std::to_string(obtenido.size());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Compara las métricas de cada proceso (mismo orden en ambas listas)
+ */
+inline bool mismasMetricas(const std::vector<Proceso*>& esperado, const std::vector<Proceso*>& obtenido,
+                           std::string& diferencia) {
+    if (esperado.size() != obtenido.size()) {
+        diferencia = "distinta cantidad de procesos";
+        return false;
+    }
+    for (size_t i = 0; i < esperado.size(); i++) {
+        const Proceso* a = esperado[i];
+        const Proceso* b = obtenido[i];
+        if (a->getEtiqueta() != b->getEtiqueta() || a->getCompletionTime() != b->getCompletionTime() ||
+            a->getWaitingTime() != b->getWaitingTime() || a->getResponseTime() != b->getResponseTime() ||
+            a->getTurnaroundTime() != b->getTurnaroundTime()) {
+            diferencia = "proceso " + a->getEtiqueta() + ": CT " + std::to_string(a->getCompletionTime()) +
+                         " RT " + std::to_string(a->getResponseTime()) + " frente a CT " +
+                         std::to_string(b->getCompletionTime()) + " RT " + std::to_string(b->getResponseTime());
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Cuenta los fallos de una prueba y los informa por std::cerr
+ */
+class Resultado {
+private:
+    std::string nombre;
+    int casos;
+    int fallos;
+    
+public:
+    explicit Resultado(const std::string& nombrePrueba) : nombre(nombrePrueba), casos(0), fallos(0) {}
+    
+    void comprobar(bool correcto, const std::string& caso, const std::string& detalle) {
+        casos++;
+        if (!correcto) {
+            fallos++;
+            if (fallos <= 10) {
+                std::cerr << nombre << ": FALLO en " << caso << ": " << detalle << std::endl;
+            }
+        }
+    }
+    
+    /**
+     * Resume la prueba
+     * @return código de salida del programa (0 si no hubo fallos)
+     */
+    int terminar() const {
+        std::cout << nombre << ": " << (casos - fallos) << "/" << casos << " casos correctos" << std::endl;
+        return fallos == 0 ? 0 : 1;
+    }
+};
+
+} // namespace CargasPrueba
+
+#endif // CARGAS_PRUEBA_H
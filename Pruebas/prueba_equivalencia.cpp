@@ -0,0 +1,277 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "CargasPrueba.h"
+#include "PlanificadorMLFQ.h"
+#include "MotorCarriles.h"
+#include "MotorFijo.h"
+#include "mlfq_api.h"
+
+/**
+ * Prueba de equivalencia de los motores alternativos con la simulación de
+ * referencia (PlanificadorMLFQ::ejecutarSimulacion) sobre cargas aleatorias
+ * con semilla y muchos empates:
+ *  - MotorCarriles: métricas por proceso y promedios de cada carga
+ *  - mlfq_simular (MotorFijo) y MotorFijo reutilizado entre configuraciones:
+ *    métricas por trabajo, promedios y número de despachos
+ *  - ejecutarSimulacionParalela: historial, métricas y promedios
+ */
+
+using namespace CargasPrueba;
+
+namespace {
+
+/**
+ * Resultado de la simulación de referencia de una carga
+ */
+struct Referencia {
+    std::vector<Proceso*> procesos;             // En el orden de la carga, con sus métricas
+    std::vector<RegistroEjecucion> historial;
+    double promedioWT;
+    double promedioCT;
+    double promedioRT;
+    double promedioTAT;
+};
+
+Referencia simularReferencia(const std::vector<Proceso*>& carga, const std::vector<ConfiguracionCola>& configuracion) {
+    Referencia referencia;
+    referencia.procesos = copiarCarga(carga);
+
+    PlanificadorMLFQ planificador;
+    planificador.configurarColas(configuracion);
+    for (Proceso* proceso : referencia.procesos) {
+        planificador.agregarProceso(proceso);
+    }
+    planificador.ejecutarSimulacion();
+
+    referencia.historial = planificador.getHistorialEjecucion();
+    referencia.promedioWT = planificador.getPromedioWT();
+    referencia.promedioCT = planificador.getPromedioCT();
+    referencia.promedioRT = planificador.getPromedioRT();
+    referencia.promedioTAT = planificador.getPromedioTAT();
+    return referencia;
+}
+
+bool mismosPromedios(const Referencia& referencia, double wt, double ct, double rt, double tat) {
+    return referencia.promedioWT == wt && referencia.promedioCT == ct &&
+           referencia.promedioRT == rt && referencia.promedioTAT == tat;
+}
+
+/**
+ * Configuración aleatoria de 1 a 6 niveles con quantums pequeños y SJF/STCF
+ */
+std::vector<ConfiguracionCola> generarConfiguracion(std::mt19937& generador) {
+    std::vector<ConfiguracionCola> configuracion;
+    int niveles = aleatorio(generador, 1, 6);
+    for (int i = 0; i < niveles; i++) {
+        int tipo = aleatorio(generador, 0, 3);
+        TipoAlgoritmo algoritmo = tipo == 2 ? TipoAlgoritmo::SJF
+                                : tipo == 3 ? TipoAlgoritmo::STCF : TipoAlgoritmo::ROUND_ROBIN;
+        configuracion.push_back(ConfiguracionCola(i + 1, algoritmo, aleatorio(generador, 1, 6)));
+    }
+    return configuracion;
+}
+
+std::vector<mlfq_nivel> nivelesAPI(const std::vector<ConfiguracionCola>& configuracion) {
+    std::vector<mlfq_nivel> niveles;
+    for (const ConfiguracionCola& config : configuracion) {
+        mlfq_nivel nivel;
+        nivel.algoritmo = config.algoritmo == TipoAlgoritmo::SJF ? MLFQ_SJF
+                        : config.algoritmo == TipoAlgoritmo::STCF ? MLFQ_STCF : MLFQ_RR;
+        nivel.quantum = config.quantum;
+        niveles.push_back(nivel);
+    }
+    return niveles;
+}
+
+std::vector<mlfq_trabajo> trabajosAPI(const std::vector<Proceso*>& carga, std::vector<std::string>& etiquetas) {
+    std::vector<mlfq_trabajo> trabajos;
+    etiquetas.clear();
+    for (const Proceso* proceso : carga) {
+        etiquetas.push_back(proceso->getEtiqueta());
+    }
+    for (size_t i = 0; i < carga.size(); i++) {
+        mlfq_trabajo trabajo;
+        trabajo.etiqueta = etiquetas[i].c_str();
+        trabajo.burstTime = carga[i]->getBurstTime();
+        trabajo.arrivalTime = carga[i]->getArrivalTime();
+        trabajo.queueLevel = carga[i]->getQueueLevel();
+        trabajo.priority = carga[i]->getPriority();
+        trabajos.push_back(trabajo);
+    }
+    return trabajos;
+}
+
+/**
+ * Compara las métricas de la API con las de la referencia
+ */
+bool mismasMetricasAPI(const Referencia& referencia, const std::vector<mlfq_metricas_trabajo>& metricas,
+                       const mlfq_resumen& resumen, std::string& diferencia) {
+    for (size_t i = 0; i < referencia.procesos.size(); i++) {
+        const Proceso* proceso = referencia.procesos[i];
+        if (proceso->getCompletionTime() != metricas[i].completionTime ||
+            proceso->getWaitingTime() != metricas[i].waitingTime ||
+            proceso->getResponseTime() != metricas[i].responseTime ||
+            proceso->getTurnaroundTime() != metricas[i].turnaroundTime) {
+            diferencia = "trabajo " + proceso->getEtiqueta() + ": CT " + std::to_string(proceso->getCompletionTime()) +
+                         " frente a " + std::to_string(metricas[i].completionTime);
+            return false;
+        }
+    }
+    if (!mismosPromedios(referencia, resumen.promedioWT, resumen.promedioCT, resumen.promedioRT, resumen.promedioTAT)) {
+        diferencia = "promedios distintos";
+        return false;
+    }
+    if (resumen.numIntervalos != static_cast<int>(referencia.historial.size())) {
+        diferencia = std::to_string(resumen.numIntervalos) + " despachos frente a " +
+                     std::to_string(referencia.historial.size()) + " intervalos";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * MotorCarriles con un lote de cargas de la misma configuración (más cargas
+ * que carriles, así algunos carriles toman una segunda carga)
+ */
+void probarCarriles(Resultado& resultado, const std::vector<std::vector<Proceso*>>& cargas,
+                    const std::vector<ConfiguracionCola>& configuracion, const std::string& caso) {
+    std::vector<std::vector<Proceso*>> copias;
+    for (const std::vector<Proceso*>& carga : cargas) {
+        copias.push_back(copiarCarga(carga));
+    }
+
+    MotorCarriles motor(configuracion);
+    std::vector<ResultadoCarga> resultados;
+    motor.simular(copias, resultados);
+
+    for (size_t i = 0; i < cargas.size(); i++) {
+        Referencia referencia = simularReferencia(cargas[i], configuracion);
+        std::string diferencia;
+        bool igual = resultados.size() == cargas.size() &&
+                     mismasMetricas(referencia.procesos, copias[i], diferencia);
+        if (igual && !mismosPromedios(referencia, resultados[i].promedioWT, resultados[i].promedioCT,
+                                      resultados[i].promedioRT, resultados[i].promedioTAT)) {
+            igual = false;
+            diferencia = "promedios distintos";
+        }
+        resultado.comprobar(igual, caso + " carga " + std::to_string(i), diferencia);
+        liberarCarga(referencia.procesos);
+        liberarCarga(copias[i]);
+    }
+}
+
+/**
+ * mlfq_simular y un MotorFijo que conserva la carga al cambiar de configuración
+ */
+void probarMotorFijo(Resultado& resultado, MotorFijo<>& fijo, const std::vector<Proceso*>& carga,
+                     const std::vector<ConfiguracionCola>& configuracion, bool cargaNueva, const std::string& caso) {
+    Referencia referencia = simularReferencia(carga, configuracion);
+    std::vector<std::string> etiquetas;
+    std::vector<mlfq_trabajo> trabajos = trabajosAPI(carga, etiquetas);
+    std::vector<mlfq_nivel> niveles = nivelesAPI(configuracion);
+    std::vector<mlfq_metricas_trabajo> metricas(trabajos.size());
+    mlfq_resumen resumen;
+    std::string diferencia;
+
+    int codigo = mlfq_simular(trabajos.data(), static_cast<int>(trabajos.size()),
+                              niveles.data(), static_cast<int>(niveles.size()), metricas.data(), &resumen);
+    diferencia = "código " + std::to_string(codigo);
+    bool igual = codigo == MLFQ_OK && mismasMetricasAPI(referencia, metricas, resumen, diferencia);
+    resultado.comprobar(igual, caso + " mlfq_simular", diferencia);
+
+    // configurar conserva la carga: solo se vuelve a cargar al cambiar de carga
+    codigo = fijo.configurar(niveles.data(), static_cast<int>(niveles.size()));
+    if (codigo == MLFQ_OK && (cargaNueva || fijo.getNumTrabajos() == 0)) {
+        codigo = fijo.cargar(trabajos.data(), static_cast<int>(trabajos.size()));
+    }
+    if (codigo == MLFQ_OK) {
+        fijo.reiniciar();
+        fijo.ejecutar();
+        fijo.obtenerMetricas(metricas.data(), &resumen);
+    }
+    diferencia = "código " + std::to_string(codigo);
+    igual = codigo == MLFQ_OK && mismasMetricasAPI(referencia, metricas, resumen, diferencia);
+    resultado.comprobar(igual, caso + " MotorFijo", diferencia);
+
+    liberarCarga(referencia.procesos);
+}
+
+/**
+ * Periodos ocupados en paralelo frente a la simulación secuencial
+ */
+void probarParalela(Resultado& resultado, const std::vector<Proceso*>& carga,
+                    const std::vector<ConfiguracionCola>& configuracion, const std::string& caso) {
+    Referencia referencia = simularReferencia(carga, configuracion);
+    std::vector<Proceso*> copia = copiarCarga(carga);
+
+    PlanificadorMLFQ planificador;
+    planificador.configurarColas(configuracion);
+    for (Proceso* proceso : copia) {
+        planificador.agregarProceso(proceso);
+    }
+    int particiones = planificador.ejecutarSimulacionParalela(4);
+
+    std::string diferencia;
+    bool igual = mismoHistorial(referencia.historial, planificador.getHistorialEjecucion(), diferencia) &&
+                 mismasMetricas(referencia.procesos, copia, diferencia);
+    if (igual && !mismosPromedios(referencia, planificador.getPromedioWT(), planificador.getPromedioCT(),
+                                  planificador.getPromedioRT(), planificador.getPromedioTAT())) {
+        igual = false;
+        diferencia = "promedios distintos";
+    }
+    resultado.comprobar(igual, caso + " (" + std::to_string(particiones) + " particiones)", diferencia);
+
+    planificador.limpiarProcesos();
+    liberarCarga(referencia.procesos);
+}
+
+} // namespace
+
+int main() {
+    Resultado resultado("prueba_equivalencia");
+    std::mt19937 generadorConfig(2024);
+
+    for (uint32_t ronda = 0; ronda < 12; ronda++) {
+        // Predefinidas primero, luego configuraciones aleatorias
+        std::vector<ConfiguracionCola> configuracion;
+        if (ronda < 3) {
+            PlanificadorMLFQ::obtenerConfiguracionPredefinida("ABC"[ronda], configuracion);
+        } else {
+            configuracion = generarConfiguracion(generadorConfig);
+        }
+        std::string nombreConfig = "config " + std::to_string(ronda);
+
+        // Cargas con empates: ráfagas pares de pocos valores, llegadas simultáneas
+        // y algunos periodos ociosos; la última supera MotorCarriles::MAX_PROCESOS
+        std::vector<std::vector<Proceso*>> cargas;
+        for (uint32_t i = 0; i < 20; i++) {
+            ParametrosCarga parametros;
+            parametros.numProcesos = (i == 19) ? 80 : 10 + static_cast<int>((i * 7) % 50);
+            parametros.separacionMaxima = 2 + static_cast<int>(i % 3);
+            parametros.niveles = static_cast<int>(configuracion.size());
+            parametros.hueco = (i % 2 == 0) ? 60 : 0;
+            cargas.push_back(generarCarga(1000 * ronda + i, parametros));
+        }
+
+        probarCarriles(resultado, cargas, configuracion, nombreConfig);
+        MotorFijo<> fijo;
+        for (size_t i = 0; i < cargas.size(); i++) {
+            std::string caso = nombreConfig + " carga " + std::to_string(i);
+            probarMotorFijo(resultado, fijo, cargas[i], configuracion, true, caso);
+            probarParalela(resultado, cargas[i], configuracion, caso + " paralela");
+        }
+
+        // Misma carga en el MotorFijo con otra configuración, sin volver a cargarla
+        std::vector<ConfiguracionCola> otra = generarConfiguracion(generadorConfig);
+        if (otra.size() >= configuracion.size()) {
+            probarMotorFijo(resultado, fijo, cargas.back(), otra, false, nombreConfig + " reconfigurado");
+        }
+
+        for (std::vector<Proceso*>& carga : cargas) {
+            liberarCarga(carga);
+        }
+    }
+
+    return resultado.terminar();
+}
@@ -0,0 +1,88 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "CargasPrueba.h"
+#include "PlanificadorMLFQ.h"
+
+/**
+ * Prueba de instantáneas: bifurcar en un instante con la misma configuración
+ * y continuar debe reproducir exactamente la ejecución sin cortes (historial,
+ * métricas por proceso y promedios), también con empates en SJF/STCF y con
+ * procesos en E/S en el momento del corte.
+ */
+
+using namespace CargasPrueba;
+
+namespace {
+
+void configurarCarga(PlanificadorMLFQ& planificador, const std::vector<ConfiguracionCola>& configuracion,
+                     const std::vector<Proceso*>& carga) {
+    planificador.configurarColas(configuracion);
+    for (Proceso* proceso : copiarCarga(carga)) {
+        planificador.agregarProceso(proceso);
+    }
+}
+
+void probarCorte(Resultado& resultado, const std::vector<Proceso*>& carga,
+                 const std::vector<ConfiguracionCola>& configuracion, const std::string& caso, int corte) {
+    PlanificadorMLFQ directo;
+    configurarCarga(directo, configuracion, carga);
+    directo.ejecutarSimulacion();
+    
+    PlanificadorMLFQ prefijo;
+    configurarCarga(prefijo, configuracion, carga);
+    prefijo.iniciarSimulacion();
+    prefijo.ejecutarHasta(corte);
+    std::string instantanea = prefijo.crearInstantanea();
+    prefijo.limpiarProcesos();
+    
+    std::vector<PlanificadorMLFQ*> bifurcaciones = PlanificadorMLFQ::bifurcar(instantanea, {configuracion});
+    std::string nombreCaso = caso + " corte " + std::to_string(corte);
+    if (bifurcaciones.size() != 1) {
+        resultado.comprobar(false, nombreCaso, "no se pudo restaurar la instantánea");
+        directo.limpiarProcesos();
+        return;
+    }
+    PlanificadorMLFQ* continuacion = bifurcaciones[0];
+    continuacion->continuarSimulacion();
+    
+    std::string diferencia;
+    bool igual = mismoHistorial(directo.getHistorialEjecucion(), continuacion->getHistorialEjecucion(), diferencia) &&
+                 mismasMetricas(directo.getProcesos(), continuacion->getProcesos(), diferencia);
+    if (igual && (directo.getPromedioRT() != continuacion->getPromedioRT() ||
+                  directo.getPromedioWT() != continuacion->getPromedioWT())) {
+        igual = false;
+        diferencia = "promedios distintos";
+    }
+    resultado.comprobar(igual, nombreCaso, diferencia);
+    
+    continuacion->limpiarProcesos();
+    delete continuacion;
+    directo.limpiarProcesos();
+}
+
+} // namespace
+
+int main() {
+    Resultado resultado("prueba_instantanea");
+    const char letras[] = {'A', 'B', 'C'};
+    
+    for (uint32_t semilla = 1; semilla <= 60; semilla++) {
+        ParametrosCarga parametros;
+        parametros.conES = (semilla % 2 == 0);
+        std::vector<Proceso*> carga = generarCarga(semilla, parametros);
+        int fin = carga.back()->getArrivalTime() + 40;
+        
+        for (char letra : letras) {
+            std::vector<ConfiguracionCola> configuracion;
+            PlanificadorMLFQ::obtenerConfiguracionPredefinida(letra, configuracion);
+            std::string caso = "semilla " + std::to_string(semilla) + " config " + letra;
+            for (int corte = 7; corte < fin; corte += 23) {
+                probarCorte(resultado, carga, configuracion, caso, corte);
+            }
+        }
+        liberarCarga(carga);
+    }
+    
+    return resultado.terminar();
+}
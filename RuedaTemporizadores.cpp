@@ -0,0 +1,170 @@
+#include "RuedaTemporizadores.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+RuedaTemporizadores::RuedaTemporizadores() : actual(0), pendientes(0) {
+    std::memset(ocupadas, 0, sizeof(ocupadas));
+}
+
+void RuedaTemporizadores::reiniciar(int tiempo) {
+    for (int nivel = 0; nivel < NIVELES; nivel++) {
+        for (int ranura = siguienteOcupada(nivel, 0); ranura >= 0; ranura = siguienteOcupada(nivel, ranura + 1)) {
+            ranuras[nivel][ranura].clear();
+        }
+    }
+    std::memset(ocupadas, 0, sizeof(ocupadas));
+    actual = std::max(0, tiempo);
+    pendientes = 0;
+}
+
+void RuedaTemporizadores::marcar(int nivel, int ranura, bool ocupada) {
+    uint64_t bit = 1ULL << (ranura % 64);
+    if (ocupada) {
+        ocupadas[nivel][ranura / 64] |= bit;
+    } else {
+        ocupadas[nivel][ranura / 64] &= ~bit;
+    }
+}
+
+/**
+ * Primera ranura ocupada de un nivel en o después de "desde" (-1 si no hay)
+ */
+int RuedaTemporizadores::siguienteOcupada(int nivel, int desde) const {
+    if (desde >= RANURAS) return -1;
+
+    int palabra = desde / 64;
+    uint64_t bits = ocupadas[nivel][palabra] & (~0ULL << (desde % 64));
+    while (bits == 0) {
+        if (++palabra >= RANURAS / 64) return -1;
+        bits = ocupadas[nivel][palabra];
+    }
+    return palabra * 64 + __builtin_ctzll(bits);
+}
+
+/**
+ * Ubica un temporizador según el bit más alto en que su vencimiento
+ * difiere del tiempo actual
+ */
+void RuedaTemporizadores::insertar(const Temporizador& temporizador) {
+    uint32_t diferencia = static_cast<uint32_t>(temporizador.vencimiento) ^ static_cast<uint32_t>(actual);
+    int nivel = 0;
+    while (nivel < NIVELES - 1 && (diferencia >> (BITS_NIVEL * (nivel + 1))) != 0) {
+        nivel++;
+    }
+    int ranura = (temporizador.vencimiento >> (BITS_NIVEL * nivel)) & (RANURAS - 1);
+    ranuras[nivel][ranura].push_back(temporizador);
+    marcar(nivel, ranura, true);
+}
+
+/**
+ * Lleva el tiempo de la rueda a "nuevo", que no debe superar ningún vencimiento
+ * pendiente. Las ranuras superiores que pasan a ser las actuales se reparten en
+ * los niveles inferiores, de arriba hacia abajo.
+ */
+void RuedaTemporizadores::saltarA(int nuevo) {
+    int anterior = actual;
+    actual = nuevo;
+
+    for (int nivel = NIVELES - 1; nivel >= 1; nivel--) {
+        int desplazamiento = BITS_NIVEL * nivel;
+        if ((anterior >> desplazamiento) == (nuevo >> desplazamiento)) {
+            continue;
+        }
+        int ranura = (nuevo >> desplazamiento) & (RANURAS - 1);
+        if (ranuras[nivel][ranura].empty()) {
+            continue;
+        }
+        std::vector<Temporizador> bajar;
+        bajar.swap(ranuras[nivel][ranura]);
+        marcar(nivel, ranura, false);
+        for (const Temporizador& temporizador : bajar) {
+            insertar(temporizador);
+        }
+    }
+}
+
+void RuedaTemporizadores::programar(Proceso* proceso, int vencimiento) {
+    Temporizador temporizador;
+    temporizador.vencimiento = std::max(vencimiento, actual);
+    temporizador.proceso = proceso;
+    insertar(temporizador);
+    pendientes++;
+}
+
+void RuedaTemporizadores::avanzarHasta(int tiempo, std::vector<Proceso*>& vencidos) {
+    while (pendientes > 0) {
+        int proximo = proximoVencimiento();
+        if (proximo > tiempo) break;
+
+        if (proximo > actual) {
+            saltarA(proximo);
+        }
+        int ranura = proximo & (RANURAS - 1);
+        std::vector<Temporizador>& lista = ranuras[0][ranura];
+        for (const Temporizador& temporizador : lista) {
+            vencidos.push_back(temporizador.proceso);
+        }
+        pendientes -= lista.size();
+        lista.clear();
+        marcar(0, ranura, false);
+
+        if (proximo == INT_MAX) return;
+        saltarA(proximo + 1);
+    }
+
+    if (tiempo >= actual && tiempo < INT_MAX) {
+        saltarA(tiempo + 1);
+    }
+}
+
+/**
+ * La primera ranura ocupada del nivel más bajo contiene el mínimo: en el nivel
+ * 0 cada ranura es un único tiempo; en los demás hay que recorrer la ranura
+ */
+int RuedaTemporizadores::proximoVencimiento() const {
+    if (pendientes == 0) return -1;
+
+    int ranura = siguienteOcupada(0, actual & (RANURAS - 1));
+    if (ranura >= 0) {
+        return (actual & ~(RANURAS - 1)) | ranura;
+    }
+
+    for (int nivel = 1; nivel < NIVELES; nivel++) {
+        int indiceActual = (actual >> (BITS_NIVEL * nivel)) & (RANURAS - 1);
+        ranura = siguienteOcupada(nivel, indiceActual + 1);
+        if (ranura >= 0) {
+            int minimo = INT_MAX;
+            for (const Temporizador& temporizador : ranuras[nivel][ranura]) {
+                minimo = std::min(minimo, temporizador.vencimiento);
+            }
+            return minimo;
+        }
+    }
+    return -1;
+}
+
+std::vector<RuedaTemporizadores::Temporizador> RuedaTemporizadores::obtenerPendientes() const {
+    // Un temporizador en un nivel más alto se programó antes que uno de igual
+    // vencimiento en un nivel más bajo
+    std::vector<Temporizador> todos;
+    todos.reserve(pendientes);
+    for (int nivel = NIVELES - 1; nivel >= 0; nivel--) {
+        for (int ranura = siguienteOcupada(nivel, 0); ranura >= 0; ranura = siguienteOcupada(nivel, ranura + 1)) {
+            todos.insert(todos.end(), ranuras[nivel][ranura].begin(), ranuras[nivel][ranura].end());
+        }
+    }
+    std::stable_sort(todos.begin(), todos.end(),
+                     [](const Temporizador& a, const Temporizador& b) {
+                         return a.vencimiento < b.vencimiento;
+                     });
+    return todos;
+}
+
+bool RuedaTemporizadores::vacia() const {
+    return pendientes == 0;
+}
+
+size_t RuedaTemporizadores::getPendientes() const {
+    return pendientes;
+}
@@ -0,0 +1,81 @@
+#ifndef RUEDA_TEMPORIZADORES_H
+#define RUEDA_TEMPORIZADORES_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Proceso.h"
+
+/**
+ * Rueda jerárquica de temporizadores para los procesos bloqueados en E/S
+ *
+ * Cuatro niveles de 256 ranuras cubren todo el rango de int. Un temporizador
+ * se guarda en el nivel del bit más alto en que su vencimiento difiere del
+ * tiempo actual de la rueda, en la ranura que indican sus bits de ese nivel.
+ * Cuando el tiempo alcanza una ranura de un nivel superior, su contenido se
+ * redistribuye en los niveles inferiores (cada temporizador baja a lo sumo tres
+ * veces). Programar es O(1) y vencer es O(1) amortizado por temporizador; un
+ * mapa de bits por nivel permite saltar directamente a la próxima ranura ocupada,
+ * así los tramos sin vencimientos no se recorren tiempo a tiempo.
+ *
+ * Los temporizadores con el mismo vencimiento se entregan en el orden en que se
+ * programaron.
+ */
+class RuedaTemporizadores {
+public:
+    static const int BITS_NIVEL = 8;
+    static const int RANURAS = 1 << BITS_NIVEL;
+    static const int NIVELES = 4;
+
+    struct Temporizador {
+        int vencimiento;
+        Proceso* proceso;
+    };
+
+private:
+    std::vector<Temporizador> ranuras[NIVELES][RANURAS];
+    uint64_t ocupadas[NIVELES][RANURAS / 64];      // Ranuras no vacías por nivel
+    int actual;                                     // Todo vencimiento menor ya se entregó
+    size_t pendientes;
+
+    void insertar(const Temporizador& temporizador);
+    void saltarA(int nuevo);
+    int siguienteOcupada(int nivel, int desde) const;
+    void marcar(int nivel, int ranura, bool ocupada);
+
+public:
+    RuedaTemporizadores();
+
+    /**
+     * Descarta todos los temporizadores y fija el tiempo de la rueda
+     */
+    void reiniciar(int tiempo = 0);
+
+    /**
+     * Programa el despertar de un proceso
+     * @param vencimiento: tiempo del despertar (si ya pasó, vence en la próxima consulta)
+     */
+    void programar(Proceso* proceso, int vencimiento);
+
+    /**
+     * Entrega los temporizadores con vencimiento <= tiempo, ordenados por
+     * vencimiento y, a igual vencimiento, por orden de programación
+     * @param vencidos: se agregan al final los procesos que despiertan
+     */
+    void avanzarHasta(int tiempo, std::vector<Proceso*>& vencidos);
+
+    /**
+     * Vencimiento más cercano, o -1 si no hay temporizadores
+     */
+    int proximoVencimiento() const;
+
+    /**
+     * Temporizadores pendientes en el orden en que se entregarían
+     */
+    std::vector<Temporizador> obtenerPendientes() const;
+
+    bool vacia() const;
+    size_t getPendientes() const;
+};
+
+#endif // RUEDA_TEMPORIZADORES_H
@@ -0,0 +1,583 @@
+#include "ServidorSimulacion.h"
+#include "ArchivoUtils.h"
+#include "PlanificadorMLFQ.h"
+#include "PoolHilos.h"
+#include <iostream>
+#include <ostream>
+#include <streambuf>
+#include <iomanip>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#endif
+
+#ifndef _WIN32
+namespace {
+
+const size_t LONGITUD_MAXIMA_PETICION = 64 * 1024;
+const int SEGUNDOS_ESPERA_PETICION = 30;
+
+volatile sig_atomic_t senalRecibida = 0;
+
+void manejarSenal(int) {
+    senalRecibida = 1;
+}
+
+/**
+ * Fecha de modificación en nanosegundos: st_mtime solo tiene segundos y un
+ * archivo reescrito dos veces en el mismo segundo parecería el mismo
+ */
+long long modificacionNs(const struct stat& info) {
+#ifdef __APPLE__
+    const struct timespec& fecha = info.st_mtimespec;
+#else
+    const struct timespec& fecha = info.st_mtim;
+#endif
+    return static_cast<long long>(fecha.tv_sec) * 1000000000LL + static_cast<long long>(fecha.tv_nsec);
+}
+
+/**
+ * Procesos de una traza ya interpretada, en el orden del archivo
+ */
+struct Carga {
+    std::vector<Proceso> procesos;
+    long long modificacion;         // Nanosegundos (modificacionNs)
+    long long tamano;
+    long long inodo;
+};
+
+/**
+ * Cargas en memoria por ruta canónica; se descarta la menos usada al superar el máximo
+ */
+class CacheCargas {
+private:
+    struct Entrada {
+        std::shared_ptr<const Carga> carga;
+        unsigned long long ultimoUso;
+    };
+
+    std::mutex mutex;
+    std::map<std::string, Entrada> entradas;
+    size_t maximo;
+    unsigned long long reloj;
+
+public:
+    explicit CacheCargas(size_t maximo) : maximo(maximo > 0 ? maximo : 1), reloj(0) {}
+
+    /**
+     * Carga de la ruta, reutilizada si el archivo no cambió desde que se leyó
+     * @param enCache: true si no hubo que leer el archivo
+     * @param error: motivo si se devuelve nullptr
+     */
+    std::shared_ptr<const Carga> obtener(const std::string& ruta, bool& enCache, std::string& error) {
+        char canonica[PATH_MAX];
+        struct stat info;
+        if (realpath(ruta.c_str(), canonica) == nullptr || stat(canonica, &info) != 0 || !S_ISREG(info.st_mode)) {
+            error = "No se pudo abrir el archivo " + ruta;
+            return nullptr;
+        }
+        std::string clave(canonica);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto entrada = entradas.find(clave);
+            if (entrada != entradas.end()) {
+                const Carga& carga = *entrada->second.carga;
+                if (carga.modificacion == modificacionNs(info) &&
+                    carga.tamano == static_cast<long long>(info.st_size) &&
+                    carga.inodo == static_cast<long long>(info.st_ino)) {
+                    entrada->second.ultimoUso = ++reloj;
+                    enCache = true;
+                    return entrada->second.carga;
+                }
+            }
+        }
+
+        // Lectura fuera del candado: otras peticiones siguen atendiéndose
+        enCache = false;
+        std::vector<Proceso*> leidos = ArchivoUtils::leerArchivoProcesos(clave);
+        if (leidos.empty()) {
+            error = "Sin procesos válidos en " + ruta;
+            return nullptr;
+        }
+        std::shared_ptr<Carga> carga(new Carga());
+        carga->procesos.reserve(leidos.size());
+        for (Proceso* proceso : leidos) {
+            carga->procesos.push_back(*proceso);
+            delete proceso;
+        }
+        carga->modificacion = modificacionNs(info);
+        carga->tamano = static_cast<long long>(info.st_size);
+        carga->inodo = static_cast<long long>(info.st_ino);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        Entrada& entrada = entradas[clave];
+        entrada.carga = carga;
+        entrada.ultimoUso = ++reloj;
+        while (entradas.size() > maximo) {
+            auto menosUsada = entradas.begin();
+            for (auto it = entradas.begin(); it != entradas.end(); ++it) {
+                if (it->second.ultimoUso < menosUsada->second.ultimoUso) {
+                    menosUsada = it;
+                }
+            }
+            entradas.erase(menosUsada);
+        }
+        return carga;
+    }
+
+    bool olvidar(const std::string& ruta) {
+        char canonica[PATH_MAX];
+        std::string clave = realpath(ruta.c_str(), canonica) != nullptr ? std::string(canonica) : ruta;
+        std::lock_guard<std::mutex> lock(mutex);
+        return entradas.erase(clave) > 0;
+    }
+
+    void describir(std::ostream& salida) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& entrada : entradas) {
+            salida << "CARGA " << entrada.first << " " << entrada.second.carga->procesos.size() << " procesos\n";
+        }
+    }
+};
+
+/**
+ * Estado compartido por los trabajadores
+ */
+struct EstadoServidor {
+    CacheCargas cache;
+    std::atomic<int> activas;
+    std::atomic<bool> detener;
+    int descriptorEscucha;
+
+    EstadoServidor(size_t maxCargas, int descriptor)
+        : cache(maxCargas), activas(0), detener(false), descriptorEscucha(descriptor) {}
+};
+
+/**
+ * Salida con búfer sobre un socket: cada volcado es un write
+ */
+class SalidaSocket : public std::streambuf {
+private:
+    int descriptor;
+    char bufer[1 << 16];
+
+    bool vaciar() {
+        const char* datos = pbase();
+        size_t pendiente = static_cast<size_t>(pptr() - pbase());
+        while (pendiente > 0) {
+            ssize_t escritos = ::write(descriptor, datos, pendiente);
+            if (escritos < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            datos += escritos;
+            pendiente -= static_cast<size_t>(escritos);
+        }
+        setp(bufer, bufer + sizeof(bufer));
+        return true;
+    }
+
+protected:
+    int overflow(int caracter) override {
+        if (!vaciar()) return traits_type::eof();
+        if (caracter != traits_type::eof()) {
+            *pptr() = static_cast<char>(caracter);
+            pbump(1);
+        }
+        return traits_type::not_eof(caracter);
+    }
+
+    int sync() override {
+        return vaciar() ? 0 : -1;
+    }
+
+public:
+    explicit SalidaSocket(int descriptor) : descriptor(descriptor) {
+        setp(bufer, bufer + sizeof(bufer));
+    }
+};
+
+/**
+ * Lee la petición (una línea) del cliente
+ */
+bool leerPeticion(int descriptor, std::string& peticion) {
+    char bloque[4096];
+    peticion.clear();
+    while (peticion.size() < LONGITUD_MAXIMA_PETICION) {
+        ssize_t leidos = ::read(descriptor, bloque, sizeof(bloque));
+        if (leidos < 0 && errno == EINTR) continue;
+        if (leidos <= 0) break;
+        peticion.append(bloque, static_cast<size_t>(leidos));
+        size_t finLinea = peticion.find('\n');
+        if (finLinea != std::string::npos) {
+            peticion.resize(finLinea);
+            break;
+        }
+    }
+    peticion = ArchivoUtils::trim(peticion);
+    return !peticion.empty();
+}
+
+/**
+ * Separa "clave=valor ... archivo=<ruta>"; archivo= toma el resto de la línea
+ */
+bool leerParametros(const std::string& texto, std::map<std::string, std::string>& parametros, std::string& error) {
+    std::string resto = texto;
+    size_t posicionArchivo = resto.find("archivo=");
+    if (posicionArchivo != std::string::npos) {
+        parametros["archivo"] = ArchivoUtils::trim(resto.substr(posicionArchivo + 8));
+        resto = resto.substr(0, posicionArchivo);
+    }
+    for (const std::string& token : ArchivoUtils::split(resto, ' ')) {
+        if (token.empty()) continue;
+        size_t igual = token.find('=');
+        if (igual == std::string::npos || igual == 0) {
+            error = "Parámetro inválido: " + token;
+            return false;
+        }
+        parametros[token.substr(0, igual)] = token.substr(igual + 1);
+    }
+    return true;
+}
+
+double milisegundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+/**
+ * SIMULAR: ejecuta cada configuración y envía su resultado al terminarla
+ */
+void atenderSimulacion(const std::string& argumentos, EstadoServidor& estado, std::ostream& salida) {
+    std::map<std::string, std::string> parametros;
+    parametros["configs"] = "ABC";
+    std::string error;
+    if (!leerParametros(argumentos, parametros, error)) {
+        salida << "ERROR " << error << "\n";
+        return;
+    }
+    if (parametros["archivo"].empty()) {
+        salida << "ERROR Falta archivo=<ruta>\n";
+        return;
+    }
+
+    std::vector<char> letras;
+    for (char letra : parametros["configs"]) {
+        std::vector<ConfiguracionCola> configuraciones;
+        if (!PlanificadorMLFQ::obtenerConfiguracionPredefinida(letra, configuraciones)) {
+            salida << "ERROR Configuración desconocida '" << letra << "'\n";
+            return;
+        }
+        letras.push_back(static_cast<char>(toupper(static_cast<unsigned char>(letra))));
+    }
+
+    bool fusionar = std::atoi(parametros["fusionar"].c_str()) != 0;
+    bool detalle = std::atoi(parametros["detalle"].c_str()) != 0;
+    bool quantumAdaptativo = !parametros["quantum_adaptativo"].empty();
+    ParametrosControlQuantum controlQuantum;
+    if (quantumAdaptativo) {
+        controlQuantum.rtObjetivo = std::atof(parametros["quantum_adaptativo"].c_str());
+    }
+    ModeloCostos modeloCostos;
+    modeloCostos.costoCambioContexto = std::atoi(parametros["costo_cambio"].c_str());
+    modeloCostos.penalizacionCache = std::atoi(parametros["costo_cache"].c_str());
+    if (!parametros["vida_cache"].empty()) {
+        modeloCostos.vidaCache = std::atof(parametros["vida_cache"].c_str());
+    }
+
+    auto inicioLectura = std::chrono::steady_clock::now();
+    bool enCache = false;
+    std::shared_ptr<const Carga> carga = estado.cache.obtener(parametros["archivo"], enCache, error);
+    if (!carga) {
+        salida << "ERROR " << error << "\n";
+        return;
+    }
+    salida << std::fixed << std::setprecision(2);
+    salida << "OK " << carga->procesos.size() << " procesos ";
+    if (enCache) {
+        salida << "(en caché)\n";
+    } else {
+        salida << "(leídos en " << milisegundosDesde(inicioLectura) << " ms)\n";
+    }
+    salida.flush();
+
+    for (char letra : letras) {
+        auto inicio = std::chrono::steady_clock::now();
+        std::vector<ConfiguracionCola> configuraciones;
+        PlanificadorMLFQ::obtenerConfiguracionPredefinida(letra, configuraciones);
+
+        PlanificadorMLFQ planificador;
+        planificador.setFusionarHistorial(fusionar);
+        if (quantumAdaptativo) {
+            planificador.activarQuantumAdaptativo(controlQuantum);
+        }
+        planificador.setModeloCostos(modeloCostos);
+        planificador.configurarColas(configuraciones);
+
+        // Copias propias: la carga en caché no se modifica
+        std::vector<Proceso*> procesos;
+        procesos.reserve(carga->procesos.size());
+        for (const Proceso& proceso : carga->procesos) {
+            procesos.push_back(new Proceso(proceso));
+            planificador.agregarProceso(procesos.back());
+        }
+        planificador.ejecutarSimulacion();
+
+        salida << "CONFIG " << letra << " " << milisegundosDesde(inicio) << " ms\n";
+        salida << ArchivoUtils::encabezadoResultados();
+        ArchivoUtils::volcarFilasResultados(salida, procesos);
+        salida << ArchivoUtils::promediosResultados(planificador.getPromedioWT(), planificador.getPromedioCT(),
+                                                    planificador.getPromedioRT(), planificador.getPromedioTAT());
+        salida << ArchivoUtils::sobrecargaResultados(planificador);
+        if (detalle) {
+            salida << ArchivoUtils::encabezadoDetalle();
+            ArchivoUtils::volcarFilasHistorial(salida, planificador.getHistorialEjecucion());
+            salida << ArchivoUtils::cambiosQuantumDetalle(planificador);
+            salida << ArchivoUtils::promediosDetalle(planificador);
+        }
+        salida << "FIN_CONFIG " << letra << "\n";
+        salida.flush();
+        planificador.limpiarProcesos();
+
+        if (!salida) {
+            return;     // El cliente cerró la conexión
+        }
+    }
+    salida << "FIN\n";
+}
+
+/**
+ * Atiende una conexión: lee la petición y responde
+ */
+void atenderConexion(int descriptor, EstadoServidor& estado) {
+    struct timeval espera;
+    espera.tv_sec = SEGUNDOS_ESPERA_PETICION;
+    espera.tv_usec = 0;
+    setsockopt(descriptor, SOL_SOCKET, SO_RCVTIMEO, &espera, sizeof(espera));
+
+    SalidaSocket bufer(descriptor);
+    std::ostream salida(&bufer);
+
+    std::string peticion;
+    if (!leerPeticion(descriptor, peticion)) {
+        salida << "ERROR Petición vacía\n";
+        salida.flush();
+        return;
+    }
+
+    size_t espacio = peticion.find(' ');
+    std::string comando = peticion.substr(0, espacio);
+    std::string argumentos = espacio == std::string::npos ? "" : peticion.substr(espacio + 1);
+
+    estado.activas++;
+    if (comando == "SIMULAR") {
+        atenderSimulacion(argumentos, estado, salida);
+    } else if (comando == "ESTADO") {
+        salida << "OK\n";
+        estado.cache.describir(salida);
+        salida << "ACTIVAS " << (estado.activas.load() - 1) << "\n";
+        salida << "FIN\n";
+    } else if (comando == "OLVIDAR") {
+        std::map<std::string, std::string> parametros;
+        std::string error;
+        if (!leerParametros(argumentos, parametros, error)) {
+            salida << "ERROR " << error << "\n";
+        } else if (estado.cache.olvidar(parametros["archivo"])) {
+            salida << "OK\n";
+        } else {
+            salida << "ERROR La carga no está en memoria\n";
+        }
+    } else if (comando == "DETENER") {
+        salida << "OK Deteniendo servidor\n";
+        estado.detener = true;
+        shutdown(estado.descriptorEscucha, SHUT_RDWR);
+    } else {
+        salida << "ERROR Comando desconocido: " << comando << "\n";
+    }
+    salida.flush();
+    estado.activas--;
+}
+
+} // namespace
+#endif
+
+/**
+ * Bucle principal: acepta conexiones y las reparte en el pool
+ */
+int ServidorSimulacion::ejecutar(const OpcionesServidor& opciones) {
+#ifdef _WIN32
+    (void)opciones;
+    std::cerr << "Error: El modo servidor requiere sockets Unix (no disponible en Windows)." << std::endl;
+    return 1;
+#else
+    struct sockaddr_un direccion;
+    std::memset(&direccion, 0, sizeof(direccion));
+    direccion.sun_family = AF_UNIX;
+    if (opciones.rutaSocket.empty() || opciones.rutaSocket.size() >= sizeof(direccion.sun_path)) {
+        std::cerr << "Error: Ruta de socket inválida o demasiado larga: " << opciones.rutaSocket << std::endl;
+        return 1;
+    }
+    std::strncpy(direccion.sun_path, opciones.rutaSocket.c_str(), sizeof(direccion.sun_path) - 1);
+
+    // Un socket viejo de otra ejecución se reemplaza; cualquier otro archivo no
+    struct stat info;
+    if (lstat(opciones.rutaSocket.c_str(), &info) == 0) {
+        if (!S_ISSOCK(info.st_mode)) {
+            std::cerr << "Error: " << opciones.rutaSocket << " existe y no es un socket" << std::endl;
+            return 1;
+        }
+        unlink(opciones.rutaSocket.c_str());
+    }
+
+    // El socket se crea con permisos 0600: solo el usuario del servidor puede
+    // pedir simulaciones sobre sus archivos (aún no hay otros hilos que usen umask)
+    int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+    mode_t mascaraAnterior = umask(0177);
+    bool enlazado = descriptor >= 0 &&
+                    bind(descriptor, reinterpret_cast<struct sockaddr*>(&direccion), sizeof(direccion)) == 0;
+    umask(mascaraAnterior);
+    if (!enlazado || listen(descriptor, 64) != 0) {
+        std::cerr << "Error: No se pudo escuchar en " << opciones.rutaSocket << ": " << std::strerror(errno) << std::endl;
+        if (descriptor >= 0) close(descriptor);
+        return 1;
+    }
+
+    // Sin SA_RESTART para que accept() vuelva al recibir SIGINT/SIGTERM
+    signal(SIGPIPE, SIG_IGN);
+    struct sigaction accion;
+    std::memset(&accion, 0, sizeof(accion));
+    accion.sa_handler = manejarSenal;
+    sigemptyset(&accion.sa_mask);
+    sigaction(SIGINT, &accion, nullptr);
+    sigaction(SIGTERM, &accion, nullptr);
+
+    ArchivoUtils::setModoSilencioso(true);
+    EstadoServidor estado(opciones.maxCargas, descriptor);
+
+    {
+        // Los hilos del pool heredan SIGINT/SIGTERM bloqueadas: la señal siempre
+        // llega al hilo que espera en accept() y lo despierta
+        sigset_t senales;
+        sigset_t mascaraPrevia;
+        sigemptyset(&senales);
+        sigaddset(&senales, SIGINT);
+        sigaddset(&senales, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &senales, &mascaraPrevia);
+        PoolHilos pool(opciones.hilos);
+        pthread_sigmask(SIG_SETMASK, &mascaraPrevia, nullptr);
+
+        std::cout << "Servidor escuchando en " << opciones.rutaSocket << " con " << pool.getNumHilos()
+                  << " hilos (DETENER o Ctrl+C para terminar)" << std::endl;
+
+        while (!estado.detener && !senalRecibida) {
+            int cliente = accept(descriptor, nullptr, nullptr);
+            if (cliente < 0) {
+                if (errno == EINTR || estado.detener) continue;
+                std::cerr << "Error: accept: " << std::strerror(errno) << std::endl;
+                break;
+            }
+            pool.enviar([cliente, &estado]() {
+                atenderConexion(cliente, estado);
+                close(cliente);
+            });
+        }
+        pool.esperar();
+    }
+
+    close(descriptor);
+    unlink(opciones.rutaSocket.c_str());
+    std::cout << "Servidor detenido." << std::endl;
+    return 0;
+#endif
+}
+
+/**
+ * Cliente mínimo para scripts: envía la petición y copia la respuesta
+ */
+int ServidorSimulacion::consultar(const std::string& rutaSocket, const std::string& peticion) {
+#ifdef _WIN32
+    (void)rutaSocket;
+    (void)peticion;
+    std::cerr << "Error: El modo servidor requiere sockets Unix (no disponible en Windows)." << std::endl;
+    return 1;
+#else
+    struct sockaddr_un direccion;
+    std::memset(&direccion, 0, sizeof(direccion));
+    direccion.sun_family = AF_UNIX;
+    if (rutaSocket.size() >= sizeof(direccion.sun_path)) {
+        std::cerr << "Error: Ruta de socket demasiado larga: " << rutaSocket << std::endl;
+        return 1;
+    }
+    std::strncpy(direccion.sun_path, rutaSocket.c_str(), sizeof(direccion.sun_path) - 1);
+
+    int descriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (descriptor < 0 ||
+        connect(descriptor, reinterpret_cast<struct sockaddr*>(&direccion), sizeof(direccion)) != 0) {
+        std::cerr << "Error: No se pudo conectar a " << rutaSocket << ": " << std::strerror(errno) << std::endl;
+        if (descriptor >= 0) close(descriptor);
+        return 1;
+    }
+
+    std::string linea = peticion + "\n";
+    const char* datos = linea.data();
+    size_t pendiente = linea.size();
+    while (pendiente > 0) {
+        ssize_t escritos = ::write(descriptor, datos, pendiente);
+        if (escritos < 0 && errno == EINTR) continue;
+        if (escritos <= 0) {
+            std::cerr << "Error: No se pudo enviar la petición" << std::endl;
+            close(descriptor);
+            return 1;
+        }
+        datos += escritos;
+        pendiente -= static_cast<size_t>(escritos);
+    }
+
+    // Copia la respuesta y detecta líneas "ERROR ..."
+    const std::string marcaError = "ERROR ";
+    bool inicioLinea = true;
+    size_t coincidencia = 0;
+    bool huboError = false;
+    char bloque[1 << 16];
+    while (true) {
+        ssize_t leidos = ::read(descriptor, bloque, sizeof(bloque));
+        if (leidos < 0 && errno == EINTR) continue;
+        if (leidos <= 0) break;
+        std::cout.write(bloque, leidos);
+        for (ssize_t i = 0; i < leidos; i++) {
+            char caracter = bloque[i];
+            if (inicioLinea) {
+                coincidencia = 0;
+                inicioLinea = false;
+            }
+            if (coincidencia < marcaError.size()) {
+                coincidencia = (caracter == marcaError[coincidencia]) ? coincidencia + 1 : marcaError.size() + 1;
+                huboError = huboError || coincidencia == marcaError.size();
+            }
+            if (caracter == '\n') {
+                inicioLinea = true;
+            }
+        }
+    }
+    std::cout.flush();
+    close(descriptor);
+    return huboError ? 1 : 0;
+#endif
+}
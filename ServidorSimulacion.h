@@ -0,0 +1,58 @@
+#ifndef SERVIDOR_SIMULACION_H
+#define SERVIDOR_SIMULACION_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * Opciones del modo servidor
+ */
+struct OpcionesServidor {
+    std::string rutaSocket;         // Socket Unix en el que se escucha
+    int hilos;                      // Trabajadores que atienden peticiones (0 = núcleos disponibles)
+    size_t maxCargas;               // Cargas interpretadas que se conservan en memoria
+
+    OpcionesServidor() : hilos(0), maxCargas(16) {}
+};
+
+/**
+ * Servidor local de simulaciones sobre un socket de dominio Unix
+ *
+ * Conserva en memoria las cargas ya interpretadas, identificadas por ruta
+ * canónica, fecha de modificación, tamaño e inodo; una petición sobre una traza ya
+ * conocida solo copia los procesos y simula. Cada conexión se atiende en un
+ * hilo del pool y lleva una petición de una línea:
+ *
+ *   SIMULAR [configs=ABC] [fusionar=1] [detalle=1] [quantum_adaptativo=RT]
+ *           [costo_cambio=N] [costo_cache=N] [vida_cache=T] archivo=<ruta>
+ *   ESTADO
+ *   OLVIDAR archivo=<ruta>
+ *   DETENER
+ *
+ * (archivo= va al final y toma el resto de la línea). La respuesta de SIMULAR
+ * se envía a medida que termina cada configuración:
+ *
+ *   OK <procesos> procesos (en caché|leídos en <ms> ms)
+ *   CONFIG <X> <ms> ms
+ *   ...contenido idéntico a _ConfigX.txt (y a _ConfigX_detalle.txt con detalle=1)...
+ *   FIN_CONFIG <X>
+ *   FIN
+ *
+ * Los errores se informan con una línea "ERROR <mensaje>".
+ */
+class ServidorSimulacion {
+public:
+    /**
+     * Escucha hasta recibir DETENER, SIGINT o SIGTERM
+     * @return 0 si el servidor terminó normalmente
+     */
+    static int ejecutar(const OpcionesServidor& opciones);
+
+    /**
+     * Envía una petición a un servidor y copia la respuesta en la salida estándar
+     * @return 0 si la respuesta terminó sin ERROR
+     */
+    static int consultar(const std::string& rutaSocket, const std::string& peticion);
+};
+
+#endif // SERVIDOR_SIMULACION_H
@@ -2,10 +2,72 @@
 #include <string>
 #include <vector>
 #include <iomanip>
+#include <cstdlib>
+#include <algorithm>
+#include <thread>
 #include "Proceso.h"
 #include "Cola.h"
 #include "PlanificadorMLFQ.h"
+#include "PlanificadorMulticore.h"
+#include "PlanificadorSRPT.h"
 #include "ArchivoUtils.h"
+#include "ModoLote.h"
+#include "ModoPipeline.h"
+#include "MonteCarlo.h"
+#include "ServidorSimulacion.h"
+#include "CacheResultados.h"
+#include "Perfilador.h"
+#include "ExportadorTraza.h"
+#include "IndiceHistorial.h"
+
+/**
+ * Opciones recibidas por línea de comandos que afectan a todas las simulaciones
+ */
+struct OpcionesEjecucion {
+    bool fusionarHistorial;     // --fusionar: une intervalos consecutivos del mismo proceso
+    bool quantumAdaptativo;     // --quantum-adaptativo: ajusta los quantums RR durante la simulación
+    ParametrosControlQuantum controlQuantum;
+    ModeloCostos modeloCostos;  // --costo-cambio, --costo-cache, --vida-cache
+    std::string directorioCache;        // --cache: resultados guardados por contenido (vacío = sin caché)
+    unsigned long long bytesCache;      // --cache-max, en bytes
+    bool traza;                 // --traza: exporta la planificación en formato Chrome trace
+    int hilosParalelo;          // --paralelo: hilos por simulación (0 = secuencial)
+    
+    OpcionesEjecucion()
+        : fusionarHistorial(false), quantumAdaptativo(false), bytesCache(512ULL << 20), traza(false),
+          hilosParalelo(0) {}
+};
+
+static OpcionesEjecucion opciones;
+
+/**
+ * Aplica las opciones de línea de comandos a un planificador
+ */
+void aplicarOpciones(PlanificadorMLFQ& planificador) {
+    planificador.setFusionarHistorial(opciones.fusionarHistorial);
+    if (opciones.quantumAdaptativo) {
+        planificador.activarQuantumAdaptativo(opciones.controlQuantum);
+    }
+    planificador.setModeloCostos(opciones.modeloCostos);
+}
+
+/**
+ * Con --traza, abre la traza de la simulación y la conecta al planificador
+ */
+void conectarTraza(ExportadorTraza& exportador, PlanificadorMLFQ& planificador,
+                   const std::string& archivoEntrada, const std::string& nombre) {
+    if (opciones.traza &&
+        exportador.abrir(ExportadorTraza::nombreArchivo(archivoEntrada, "_" + nombre), nombre,
+                         planificador.getConfiguracion())) {
+        planificador.setObservador(&exportador);
+    }
+}
+
+void cerrarTraza(ExportadorTraza& exportador, const std::string& archivoEntrada, const std::string& nombre) {
+    if (opciones.traza && exportador.cerrar()) {
+        std::cout << "Traza escrita en: " << ExportadorTraza::nombreArchivo(archivoEntrada, "_" + nombre) << std::endl;
+    }
+}
 
 /**
  * Función para mostrar el menú de opciones
@@ -18,14 +80,83 @@ void mostrarMenu() {
     std::cout << "4. Ejecutar todas las configuraciones" << std::endl;
     std::cout << "5. Configuración personalizada" << std::endl;
     std::cout << "6. Salir" << std::endl;
+    // Las opciones nuevas van después de Salir: los scripts que terminan con 6 siguen funcionando
+    std::cout << "7. Simulación multinúcleo con robo de trabajo" << std::endl;
+    std::cout << "8. Bifurcar simulación desde una instantánea" << std::endl;
     std::cout << "Seleccione una opción: ";
 }
 
+/**
+ * Promedios de SRPT sobre la carga del menú; se calculan una sola vez por
+ * opción aunque se comparen varias configuraciones (opción 4)
+ */
+struct ReferenciaSRPT {
+    bool calculada;
+    double promedioWT;
+    double promedioTAT;
+    std::string archivo;
+    
+    ReferenciaSRPT() : calculada(false), promedioWT(0), promedioTAT(0) {}
+};
+
+/**
+ * Simula SRPT sobre una copia de la carga (si aún no se hizo) y escribe <base>_SRPT.txt
+ */
+void calcularSRPT(const std::string& archivoEntrada, const std::vector<Proceso*>& procesos,
+                  ReferenciaSRPT& referencia) {
+    if (referencia.calculada) {
+        return;
+    }
+    std::vector<Proceso*> copias;
+    copias.reserve(procesos.size());
+    PlanificadorSRPT srpt;
+    for (const Proceso* proceso : procesos) {
+        copias.push_back(new Proceso(*proceso));
+        srpt.agregarProceso(copias.back());
+    }
+    srpt.ejecutarSimulacion();
+    
+    referencia.archivo = ArchivoUtils::generarNombreSalida(archivoEntrada, "_SRPT");
+    ArchivoUtils::escribirResultados(referencia.archivo, copias, srpt.getPromedioWT(), srpt.getPromedioCT(),
+                                     srpt.getPromedioRT(), srpt.getPromedioTAT(),
+                                     "Resultados de referencia SRPT");
+    referencia.promedioWT = srpt.getPromedioWT();
+    referencia.promedioTAT = srpt.getPromedioTAT();
+    referencia.calculada = true;
+    for (Proceso* copia : copias) {
+        delete copia;
+    }
+}
+
+/**
+ * Muestra cuánto se aleja la configuración de la referencia SRPT
+ */
+void compararConSRPT(const ReferenciaSRPT& referencia, const std::string& nombreConfig,
+                     double promedioWT, double promedioTAT) {
+    std::cout << "\n=== COMPARACIÓN CON SRPT ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "SRPT: WT " << referencia.promedioWT << ", TAT " << referencia.promedioTAT
+              << " (resultados en " << referencia.archivo << ")" << std::endl;
+    std::cout << nombreConfig << " / SRPT: WT ";
+    if (referencia.promedioWT > 0) {
+        std::cout << promedioWT / referencia.promedioWT << "x";
+    } else {
+        std::cout << "-";
+    }
+    std::cout << ", TAT ";
+    if (referencia.promedioTAT > 0) {
+        std::cout << promedioTAT / referencia.promedioTAT << "x";
+    } else {
+        std::cout << "-";
+    }
+    std::cout << std::endl;
+}
+
 /**
  * Función para ejecutar una simulación con una configuración específica
  */
 void ejecutarSimulacion(const std::string& archivoEntrada, const std::string& nombreConfig, 
-                       int tipoConfig, bool modoDebug = false) {
+                       int tipoConfig, ReferenciaSRPT& srpt, bool modoDebug = false) {
     
     std::cout << "\n--- Ejecutando " << nombreConfig << " ---" << std::endl;
     
@@ -39,6 +170,7 @@ void ejecutarSimulacion(const std::string& archivoEntrada, const std::string& no
     
     // Crear planificador
     PlanificadorMLFQ planificador(modoDebug);
+    aplicarOpciones(planificador);
     
     // Configurar según el tipo
     switch (tipoConfig) {
@@ -56,23 +188,71 @@ void ejecutarSimulacion(const std::string& archivoEntrada, const std::string& no
             return;
     }
     
+    std::string archivoSalida = ArchivoUtils::generarNombreSalida(archivoEntrada, "_" + nombreConfig);
+    std::string archivoReporte = ArchivoUtils::generarNombreSalida(archivoEntrada, "_" + nombreConfig + "_detalle");
+    
+    // Misma carga, configuración y opciones que una simulación anterior: se copian sus salidas
+    // (la traza no se guarda en la caché, así que con --traza se simula igual)
+    CacheResultados cache(opciones.directorioCache, opciones.bytesCache);
+    std::string clave;
+    if (cache.activa()) {
+        clave = CacheResultados::calcularClave(procesos, planificador);
+        ResumenGuardado resumen;
+        if (!opciones.traza && cache.restaurar(clave, archivoSalida, archivoReporte, resumen)) {
+            calcularSRPT(archivoEntrada, procesos, srpt);
+            compararConSRPT(srpt, nombreConfig, resumen.promedioWT, resumen.promedioTAT);
+            for (Proceso* proceso : procesos) {
+                delete proceso;
+            }
+            std::cout << "Resultado recuperado de la caché (" << clave << ")" << std::endl;
+            std::cout << "Resultados escritos en: " << archivoSalida << std::endl;
+            std::cout << "Reporte detallado escrito en: " << archivoReporte << std::endl;
+            std::cout << "\n=== PROMEDIOS ===" << std::endl;
+            std::cout << std::fixed << std::setprecision(2);
+            std::cout << "Waiting Time (WT): " << resumen.promedioWT << std::endl;
+            std::cout << "Completion Time (CT): " << resumen.promedioCT << std::endl;
+            std::cout << "Response Time (RT): " << resumen.promedioRT << std::endl;
+            std::cout << "Turnaround Time (TAT): " << resumen.promedioTAT << std::endl;
+            return;
+        }
+    }
+    
+    // La referencia se simula antes, mientras los procesos no tienen métricas
+    calcularSRPT(archivoEntrada, procesos, srpt);
+    
     // Agregar procesos al planificador
     for (Proceso* proceso : procesos) {
         planificador.agregarProceso(proceso);
     }
     
     // Ejecutar simulación
-    planificador.ejecutarSimulacion();
+    ExportadorTraza exportador;
+    conectarTraza(exportador, planificador, archivoEntrada, nombreConfig);
+    if (opciones.hilosParalelo > 0) {
+        int particiones = planificador.ejecutarSimulacionParalela(opciones.hilosParalelo);
+        std::cout << "Simulado en " << particiones << (particiones == 1 ? " partición" : " particiones") << std::endl;
+    } else {
+        planificador.ejecutarSimulacion();
+    }
     
     // Generar archivos de salida
-    std::string archivoSalida = ArchivoUtils::generarNombreSalida(archivoEntrada, "_" + nombreConfig);
-    std::string archivoReporte = ArchivoUtils::generarNombreSalida(archivoEntrada, "_" + nombreConfig + "_detalle");
-    
     ArchivoUtils::escribirResultados(archivoSalida, procesos, planificador);
     ArchivoUtils::escribirReporteDetallado(archivoReporte, planificador);
+    cerrarTraza(exportador, archivoEntrada, nombreConfig);
+    
+    if (cache.activa()) {
+        ResumenGuardado resumen;
+        resumen.procesos = procesos.size();
+        resumen.promedioWT = planificador.getPromedioWT();
+        resumen.promedioCT = planificador.getPromedioCT();
+        resumen.promedioRT = planificador.getPromedioRT();
+        resumen.promedioTAT = planificador.getPromedioTAT();
+        cache.guardar(clave, archivoSalida, archivoReporte, resumen);
+    }
     
     // Mostrar resultados en consola
     planificador.mostrarResultados();
+    compararConSRPT(srpt, nombreConfig, planificador.getPromedioWT(), planificador.getPromedioTAT());
     
     // Limpiar memoria
     planificador.limpiarProcesos();
@@ -85,17 +265,38 @@ void configuracionPersonalizada(const std::string& archivoEntrada) {
     std::cout << "\n=== CONFIGURACIÓN PERSONALIZADA ===" << std::endl;
     
     int numColas;
-    std::cout << "Ingrese el número de colas (1-4): ";
+    std::cout << "Ingrese el número de colas (1-" << MapaNiveles::MAX_NIVELES << "): ";
     std::cin >> numColas;
     
-    if (numColas < 1 || numColas > 4) {
+    if (numColas < 1 || numColas > MapaNiveles::MAX_NIVELES) {
         std::cout << "Número de colas inválido." << std::endl;
         return;
     }
     
     std::vector<ConfiguracionCola> configuraciones;
     
-    for (int i = 1; i <= numColas; i++) {
+    // Jerarquías profundas: Round Robin en todos los niveles con quantum creciente
+    int modoDefinicion = 1;
+    if (numColas > 4) {
+        std::cout << "1. Definir cada cola" << std::endl;
+        std::cout << "2. Round Robin escalonado (quantum = base + incremento x (nivel - 1))" << std::endl;
+        std::cout << "Seleccione: ";
+        std::cin >> modoDefinicion;
+    }
+    if (modoDefinicion == 2) {
+        int quantumBase;
+        int incremento;
+        std::cout << "Quantum del nivel 1: ";
+        std::cin >> quantumBase;
+        std::cout << "Incremento por nivel: ";
+        std::cin >> incremento;
+        for (int i = 1; i <= numColas; i++) {
+            configuraciones.push_back(ConfiguracionCola(i, TipoAlgoritmo::ROUND_ROBIN,
+                                                        std::max(1, quantumBase + incremento * (i - 1))));
+        }
+    }
+    
+    for (int i = 1; i <= numColas && modoDefinicion != 2; i++) {
         std::cout << "\nCola " << i << ":" << std::endl;
         std::cout << "1. Round Robin" << std::endl;
         std::cout << "2. SJF" << std::endl;
@@ -138,27 +339,477 @@ void configuracionPersonalizada(const std::string& archivoEntrada) {
     }
     
     PlanificadorMLFQ planificador(true); // Debug activado para configuración personalizada
+    aplicarOpciones(planificador);
     planificador.configurarColas(configuraciones);
     
     for (Proceso* proceso : procesos) {
         planificador.agregarProceso(proceso);
     }
     
+    ExportadorTraza exportador;
+    conectarTraza(exportador, planificador, archivoEntrada, "personalizado");
     planificador.ejecutarSimulacion();
     
     // Generar archivo de salida
     std::string archivoSalida = ArchivoUtils::generarNombreSalida(archivoEntrada, "_personalizado");
     ArchivoUtils::escribirResultados(archivoSalida, procesos, planificador);
+    cerrarTraza(exportador, archivoEntrada, "personalizado");
+    
+    planificador.limpiarProcesos();
+}
+
+/**
+ * Función para la simulación multinúcleo con colas por núcleo y robo de trabajo
+ */
+void simulacionMulticore(const std::string& archivoEntrada) {
+    std::cout << "\n=== SIMULACIÓN MULTINÚCLEO ===" << std::endl;
+    
+    int numNucleos;
+    std::cout << "Ingrese el número de núcleos: ";
+    std::cin >> numNucleos;
+    
+    if (numNucleos < 1) {
+        std::cout << "Número de núcleos inválido." << std::endl;
+        return;
+    }
+    
+    int tipoConfig;
+    std::cout << "Configuración de colas (1=A, 2=B, 3=C): ";
+    std::cin >> tipoConfig;
+    
+    std::vector<ConfiguracionCola> configuraciones;
+    std::string nombreConfig;
+    switch (tipoConfig) {
+        case 1:
+            configuraciones = PlanificadorMLFQ::obtenerConfiguracionA();
+            nombreConfig = "ConfigA";
+            break;
+        case 2:
+            configuraciones = PlanificadorMLFQ::obtenerConfiguracionB();
+            nombreConfig = "ConfigB";
+            break;
+        case 3:
+            configuraciones = PlanificadorMLFQ::obtenerConfiguracionC();
+            nombreConfig = "ConfigC";
+            break;
+        default:
+            std::cout << "Configuración no válida." << std::endl;
+            return;
+    }
+    
+    std::cout << "Política de ubicación inicial:" << std::endl;
+    std::cout << "1. Round Robin entre núcleos" << std::endl;
+    std::cout << "2. Núcleo menos cargado" << std::endl;
+    std::cout << "3. Afinidad por etiqueta" << std::endl;
+    int tipoPolitica;
+    std::cout << "Seleccione política: ";
+    std::cin >> tipoPolitica;
+    
+    PoliticaUbicacion politica;
+    switch (tipoPolitica) {
+        case 1:
+            politica = PoliticaUbicacion::ROUND_ROBIN;
+            break;
+        case 3:
+            politica = PoliticaUbicacion::AFINIDAD;
+            break;
+        default:
+            politica = PoliticaUbicacion::MENOS_CARGADO;
+    }
+    
+    int costoMigracion;
+    std::cout << "Costo de migración por robo de trabajo: ";
+    std::cin >> costoMigracion;
+    
+    std::vector<Proceso*> procesos = ArchivoUtils::leerArchivoProcesos(archivoEntrada);
+    
+    if (procesos.empty()) {
+        std::cout << "No se pudieron cargar procesos del archivo." << std::endl;
+        return;
+    }
+    
+    // El multinúcleo no modela la E/S: rechazar la carga en vez de dar métricas falsas
+    for (const Proceso* proceso : procesos) {
+        if (proceso->esMultirafaga()) {
+            std::cout << "Error: La simulación multinúcleo no admite procesos con ráfagas de E/S ("
+                      << proceso->getEtiqueta() << "). Use las opciones 1-5." << std::endl;
+            for (Proceso* liberar : procesos) {
+                delete liberar;
+            }
+            return;
+        }
+    }
+    
+    PlanificadorMulticore planificador(numNucleos);
+    planificador.configurarColas(configuraciones);
+    planificador.setPoliticaUbicacion(politica);
+    planificador.setCostoMigracion(costoMigracion);
+    
+    for (Proceso* proceso : procesos) {
+        planificador.agregarProceso(proceso);
+    }
+    
+    // La traza se escribe durante la simulación: intervalos, fines y profundidad por núcleo
+    std::string sufijo = "_" + nombreConfig + "_" + std::to_string(numNucleos) + "nucleos";
+    ExportadorTraza exportador;
+    if (opciones.traza &&
+        exportador.abrir(ExportadorTraza::nombreArchivo(archivoEntrada, sufijo), sufijo.substr(1),
+                         configuraciones, numNucleos)) {
+        planificador.setObservador(&exportador);
+    }
+    
+    planificador.ejecutarSimulacion();
+    
+    // Generar archivos de salida
+    std::string archivoSalida = ArchivoUtils::generarNombreSalida(archivoEntrada, sufijo);
+    std::string archivoReporte = ArchivoUtils::generarNombreSalida(archivoEntrada, sufijo + "_detalle");
+    
+    ArchivoUtils::escribirResultados(archivoSalida, procesos,
+                                     planificador.getPromedioWT(), planificador.getPromedioCT(),
+                                     planificador.getPromedioRT(), planificador.getPromedioTAT());
+    ArchivoUtils::escribirReporteMulticore(archivoReporte, planificador);
+    cerrarTraza(exportador, archivoEntrada, sufijo.substr(1));
+    
+    planificador.mostrarResultados();
     
     planificador.limpiarProcesos();
 }
 
+/**
+ * Función para simular un prefijo común, guardarlo como instantánea y
+ * continuarlo con cada una de las configuraciones predefinidas
+ */
+void bifurcarDesdeInstantanea(const std::string& archivoEntrada) {
+    std::cout << "\n=== BIFURCACIÓN DESDE INSTANTÁNEA ===" << std::endl;
+    
+    int tipoConfig;
+    std::cout << "Configuración para el prefijo (1=A, 2=B, 3=C): ";
+    std::cin >> tipoConfig;
+    
+    if (tipoConfig < 1 || tipoConfig > 3) {
+        std::cout << "Configuración no válida." << std::endl;
+        return;
+    }
+    
+    int tiempoCorte;
+    std::cout << "Tiempo de corte del prefijo: ";
+    std::cin >> tiempoCorte;
+    
+    std::vector<Proceso*> procesos = ArchivoUtils::leerArchivoProcesos(archivoEntrada);
+    
+    if (procesos.empty()) {
+        std::cout << "No se pudieron cargar procesos del archivo." << std::endl;
+        return;
+    }
+    
+    const std::string nombres[] = {"ConfigA", "ConfigB", "ConfigC"};
+    std::vector<std::vector<ConfiguracionCola>> continuaciones = {
+        PlanificadorMLFQ::obtenerConfiguracionA(),
+        PlanificadorMLFQ::obtenerConfiguracionB(),
+        PlanificadorMLFQ::obtenerConfiguracionC()
+    };
+    
+    // Simular el prefijo común y guardarlo
+    PlanificadorMLFQ planificador;
+    aplicarOpciones(planificador);
+    planificador.configurarColas(continuaciones[tipoConfig - 1]);
+    for (Proceso* proceso : procesos) {
+        planificador.agregarProceso(proceso);
+    }
+    planificador.iniciarSimulacion();
+    planificador.ejecutarHasta(tiempoCorte);
+    
+    std::string instantanea = planificador.crearInstantanea();
+    std::string prefijo = "_" + nombres[tipoConfig - 1] + "_t" + std::to_string(planificador.getTiempoActual());
+    std::string archivoInstantanea = ArchivoUtils::generarNombreSalida(archivoEntrada, prefijo);
+    archivoInstantanea = archivoInstantanea.substr(0, archivoInstantanea.find_last_of('.')) + ".snap";
+    ArchivoUtils::guardarInstantanea(archivoInstantanea, instantanea);
+    planificador.limpiarProcesos();
+    
+    // Continuar el mismo prefijo con cada configuración
+    std::vector<PlanificadorMLFQ*> bifurcaciones = PlanificadorMLFQ::bifurcar(instantanea, continuaciones);
+    for (size_t i = 0; i < bifurcaciones.size(); i++) {
+        PlanificadorMLFQ* continuacion = bifurcaciones[i];
+        aplicarOpciones(*continuacion);
+        continuacion->continuarSimulacion();
+        
+        std::string sufijo = prefijo + "_" + nombres[i];
+        ArchivoUtils::escribirResultados(ArchivoUtils::generarNombreSalida(archivoEntrada, sufijo),
+                                         continuacion->getProcesos(), *continuacion);
+        ArchivoUtils::escribirReporteDetallado(ArchivoUtils::generarNombreSalida(archivoEntrada, sufijo + "_detalle"),
+                                               *continuacion);
+        
+        std::cout << "\n--- Continuación con " << nombres[i] << " ---" << std::endl;
+        continuacion->mostrarResultados();
+        
+        continuacion->limpiarProcesos();
+        delete continuacion;
+    }
+}
+
+/**
+ * Interpreta "N" o "A-B" como el rango [A, B) (un instante N es [N, N+1))
+ */
+bool interpretarRango(const std::string& texto, int& desde, int& hasta) {
+    size_t guion = texto.find('-', 1);
+    char* fin = nullptr;
+    long valorDesde = std::strtol(texto.c_str(), &fin, 10);
+    if (fin == texto.c_str() || (guion == std::string::npos ? *fin != '\0' : *fin != '-')) {
+        return false;
+    }
+    long valorHasta = valorDesde + 1;
+    if (guion != std::string::npos) {
+        const char* inicioHasta = texto.c_str() + guion + 1;
+        valorHasta = std::strtol(inicioHasta, &fin, 10);
+        if (fin == inicioHasta || *fin != '\0') {
+            return false;
+        }
+    }
+    desde = static_cast<int>(valorDesde);
+    hasta = static_cast<int>(valorHasta);
+    return true;
+}
+
+/**
+ * Responde una consulta sobre el historial indexado:
+ *   t=N          intervalos en ejecución en el instante N
+ *   t=A-B        intervalos que se solapan con [A, B)
+ *   p=X          intervalos del proceso X
+ *   p=X@A-B      intervalos del proceso X que se solapan con [A, B)
+ * @return false si la consulta no es válida
+ */
+bool responderConsultaHistorial(const IndiceHistorial& indice, bool multinucleo, const std::string& consulta) {
+    std::vector<size_t> posiciones;
+    int desde = 0;
+    int hasta = 0;
+    if (consulta.compare(0, 2, "t=") == 0 && interpretarRango(consulta.substr(2), desde, hasta)) {
+        posiciones = indice.enRango(desde, hasta);
+    } else if (consulta.compare(0, 2, "p=") == 0 && consulta.size() > 2) {
+        size_t arroba = consulta.rfind('@');
+        if (arroba != std::string::npos && arroba > 2) {
+            if (!interpretarRango(consulta.substr(arroba + 1), desde, hasta)) {
+                return false;
+            }
+            posiciones = indice.deProceso(consulta.substr(2, arroba - 2), desde, hasta);
+        } else {
+            posiciones = indice.deProceso(consulta.substr(2));
+        }
+    } else {
+        return false;
+    }
+    
+    std::cout << "# " << consulta << ": " << posiciones.size() << " intervalos" << std::endl;
+    for (size_t posicion : posiciones) {
+        const RegistroEjecucion& registro = indice.getRegistro(posicion);
+        if (multinucleo) {
+            std::cout << indice.getNucleo(posicion) << ";";
+        }
+        std::cout << registro.etiquetaProceso << ";"
+                  << registro.tiempoInicio << ";"
+                  << registro.tiempoFin << ";"
+                  << registro.nivelCola << ";"
+                  << registro.algoritmo << std::endl;
+    }
+    return true;
+}
+
+/**
+ * --historial: indexa el historial de un reporte detallado y responde la
+ * consulta, o una por línea de la entrada estándar si la consulta es "-"
+ */
+int consultarHistorial(const std::string& archivoReporte, const std::string& consulta) {
+    bool multinucleo = false;
+    std::vector<RegistroEjecucionNucleo> historial = ArchivoUtils::leerHistorial(archivoReporte, multinucleo);
+    if (historial.empty()) {
+        return 1;
+    }
+    
+    IndiceHistorial indice;
+    indice.construir(historial);
+    std::cout << "# " << indice.getNumRegistros() << " intervalos de " << indice.getNumProcesos()
+              << " procesos en " << indice.getNumNucleos() << (indice.getNumNucleos() == 1 ? " núcleo" : " núcleos")
+              << std::endl;
+    std::cout << (multinucleo ? "Nucleo;" : "") << "Proceso;Tiempo_Inicio;Tiempo_Fin;Nivel_Cola;Algoritmo" << std::endl;
+    
+    if (consulta != "-") {
+        if (!responderConsultaHistorial(indice, multinucleo, consulta)) {
+            std::cerr << "Consulta inválida: " << consulta << " (t=N, t=A-B, p=X o p=X@A-B)" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+    
+    std::string linea;
+    while (std::getline(std::cin, linea)) {
+        linea = ArchivoUtils::trim(linea);
+        if (linea.empty()) continue;
+        if (!responderConsultaHistorial(indice, multinucleo, linea)) {
+            std::cerr << "Consulta inválida: " << linea << " (t=N, t=A-B, p=X o p=X@A-B)" << std::endl;
+        }
+    }
+    return 0;
+}
+
 /**
  * Función principal
  */
-int main() {
+int main(int argc, char* argv[]) {
     std::string archivoEntrada;
     
+    // Opciones de línea de comandos
+    OpcionesLote opcionesLote;
+    OpcionesMonteCarlo opcionesMonteCarlo;
+    bool modoLote = false;
+    bool modoPipeline = false;
+    OpcionesPipeline opcionesPipeline;
+    bool modoMonteCarlo = false;
+    OpcionesServidor opcionesServidor;
+    bool modoServidor = false;
+    
+    for (int i = 1; i < argc; i++) {
+        std::string argumento = argv[i];
+        bool tieneValor = (i + 1 < argc);
+        
+        if (argumento == "--fusionar") {
+            opciones.fusionarHistorial = true;
+        } else if (argumento == "--traza") {
+            opciones.traza = true;
+        } else if (argumento == "--paralelo") {
+            opciones.hilosParalelo = -1;    // Se resuelve con --hilos al terminar de leer las opciones
+        } else if (argumento == "--quantum-adaptativo" && tieneValor) {
+            opciones.quantumAdaptativo = true;
+            opciones.controlQuantum.rtObjetivo = std::atof(argv[++i]);
+        } else if (argumento == "--quantum-min" && tieneValor) {
+            opciones.controlQuantum.quantumMinimo = std::atoi(argv[++i]);
+        } else if (argumento == "--quantum-max" && tieneValor) {
+            opciones.controlQuantum.quantumMaximo = std::atoi(argv[++i]);
+        } else if (argumento == "--ventana" && tieneValor) {
+            opciones.controlQuantum.ventana = std::atoi(argv[++i]);
+        } else if (argumento == "--costo-cambio" && tieneValor) {
+            opciones.modeloCostos.costoCambioContexto = std::atoi(argv[++i]);
+        } else if (argumento == "--costo-cache" && tieneValor) {
+            opciones.modeloCostos.penalizacionCache = std::atoi(argv[++i]);
+        } else if (argumento == "--vida-cache" && tieneValor) {
+            opciones.modeloCostos.vidaCache = std::atof(argv[++i]);
+        } else if (argumento == "--lote" && tieneValor) {
+            modoLote = true;
+            opcionesLote.patron = argv[++i];
+        } else if (argumento == "--pipeline" && tieneValor) {
+            modoPipeline = true;
+            opcionesPipeline.archivo = argv[++i];
+        } else if (argumento == "--tramo" && tieneValor) {
+            opcionesPipeline.procesosPorTramo = std::strtoull(argv[++i], nullptr, 10);
+        } else if (argumento == "--configs" && tieneValor) {
+            opcionesLote.configuraciones = argv[++i];
+        } else if (argumento == "--hilos" && tieneValor) {
+            opcionesLote.hilos = std::atoi(argv[++i]);
+        } else if (argumento == "--resumen" && tieneValor) {
+            opcionesLote.archivoResumen = argv[++i];
+        } else if (argumento == "--cache" && tieneValor) {
+            opciones.directorioCache = argv[++i];
+        } else if (argumento == "--cache-max" && tieneValor) {
+            opciones.bytesCache = std::strtoull(argv[++i], nullptr, 10) << 20;
+        } else if (argumento == "--profile") {
+            Perfilador::activar();
+        } else if (argumento == "--profile-json" && tieneValor) {
+            Perfilador::activar(argv[++i]);
+        } else if (argumento == "--servidor" && tieneValor) {
+            modoServidor = true;
+            opcionesServidor.rutaSocket = argv[++i];
+        } else if (argumento == "--cache-cargas" && tieneValor) {
+            opcionesServidor.maxCargas = std::strtoull(argv[++i], nullptr, 10);
+        } else if (argumento == "--consultar" && i + 2 < argc) {
+            std::string rutaSocket = argv[++i];
+            return ServidorSimulacion::consultar(rutaSocket, argv[++i]);
+        } else if (argumento == "--historial" && i + 2 < argc) {
+            std::string archivoReporte = argv[++i];
+            return consultarHistorial(archivoReporte, argv[++i]);
+        } else if (argumento == "--montecarlo") {
+            modoMonteCarlo = true;
+        } else if (argumento == "--mc-procesos" && tieneValor) {
+            opcionesMonteCarlo.carga.numProcesos = std::atoi(argv[++i]);
+        } else if (argumento == "--mc-rafaga" && tieneValor) {
+            opcionesMonteCarlo.carga.mediaRafaga = std::atof(argv[++i]);
+        } else if (argumento == "--mc-llegadas" && tieneValor) {
+            opcionesMonteCarlo.carga.mediaEntreLlegadas = std::atof(argv[++i]);
+        } else if (argumento == "--mc-niveles" && tieneValor) {
+            opcionesMonteCarlo.carga.nivelInicialMaximo = std::atoi(argv[++i]);
+        } else if (argumento == "--replicas-min" && tieneValor) {
+            opcionesMonteCarlo.replicasMinimas = std::atoi(argv[++i]);
+        } else if (argumento == "--replicas-max" && tieneValor) {
+            opcionesMonteCarlo.replicasMaximas = std::atoi(argv[++i]);
+        } else if (argumento == "--confianza" && tieneValor) {
+            opcionesMonteCarlo.confianza = std::atof(argv[++i]);
+        } else if (argumento == "--semilla" && tieneValor) {
+            opcionesMonteCarlo.semilla = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::cout << "Opción desconocida: " << argumento << std::endl;
+            std::cout << "Uso: " << argv[0] << " [--fusionar] [--quantum-adaptativo RT [--quantum-min N]"
+                      << " [--quantum-max N] [--ventana N]]" << std::endl;
+            std::cout << "     " << argv[0] << " [--costo-cambio N] [--costo-cache N] [--vida-cache T]"
+                      << "   (modelo de costos, también en lote y tubería)" << std::endl;
+            std::cout << "     " << argv[0] << " [--cache <directorio> [--cache-max MB]]"
+                      << "   (resultados guardados, también en lote)" << std::endl;
+            std::cout << "     " << argv[0] << " [--profile] [--profile-json archivo]"
+                      << "   (tiempo y contadores por fase al terminar)" << std::endl;
+            std::cout << "     " << argv[0] << " --lote <directorio|patrón> [--configs ABC] [--hilos N]"
+                      << " [--resumen archivo] [--fusionar]" << std::endl;
+            std::cout << "     " << argv[0] << " [--paralelo [--hilos N]]"
+                      << "   (periodos ocupados de una simulación en paralelo)" << std::endl;
+            std::cout << "     " << argv[0] << " [--traza]"
+                      << "   (planificación en formato Chrome trace, también en tubería)" << std::endl;
+            std::cout << "     " << argv[0] << " --pipeline <archivo> [--configs ABC] [--tramo N] [--fusionar]" << std::endl;
+            std::cout << "     " << argv[0] << " --montecarlo [--mc-procesos N] [--mc-rafaga media]"
+                      << " [--mc-llegadas media] [--mc-niveles K] [--configs ABC] [--replicas-min N]"
+                      << " [--replicas-max N] [--confianza 0.95] [--semilla S] [--hilos N]" << std::endl;
+            std::cout << "     " << argv[0] << " --servidor <socket> [--hilos N] [--cache-cargas N]" << std::endl;
+            std::cout << "     " << argv[0] << " --consultar <socket> \"<petición>\"" << std::endl;
+            std::cout << "     " << argv[0] << " --historial <reporte_detalle> <t=N|t=A-B|p=X|p=X@A-B|->" << std::endl;
+            return 1;
+        }
+    }
+    
+    if (opciones.hilosParalelo < 0) {
+        opciones.hilosParalelo = opcionesLote.hilos > 0
+            ? opcionesLote.hilos : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    
+    if (modoServidor) {
+        opcionesServidor.hilos = opcionesLote.hilos;
+        return ServidorSimulacion::ejecutar(opcionesServidor);
+    }
+    
+    if (modoMonteCarlo) {
+        opcionesMonteCarlo.configuraciones = opcionesLote.configuraciones;
+        opcionesMonteCarlo.hilos = opcionesLote.hilos;
+        ResultadoMonteCarlo resultado = MonteCarlo::ejecutar(opcionesMonteCarlo);
+        if (resultado.replicas == 0) {
+            return 1;
+        }
+        MonteCarlo::mostrarResultado(resultado, opcionesMonteCarlo.confianza);
+        return 0;
+    }
+    
+    if (modoPipeline) {
+        opcionesPipeline.configuraciones = opcionesLote.configuraciones;
+        opcionesPipeline.fusionarHistorial = opciones.fusionarHistorial;
+        opcionesPipeline.quantumAdaptativo = opciones.quantumAdaptativo;
+        opcionesPipeline.controlQuantum = opciones.controlQuantum;
+        opcionesPipeline.modeloCostos = opciones.modeloCostos;
+        opcionesPipeline.traza = opciones.traza;
+        return ModoPipeline::ejecutar(opcionesPipeline);
+    }
+    
+    if (modoLote) {
+        opcionesLote.fusionarHistorial = opciones.fusionarHistorial;
+        opcionesLote.quantumAdaptativo = opciones.quantumAdaptativo;
+        opcionesLote.controlQuantum = opciones.controlQuantum;
+        opcionesLote.modeloCostos = opciones.modeloCostos;
+        opcionesLote.directorioCache = opciones.directorioCache;
+        opcionesLote.bytesCache = opciones.bytesCache;
+        return ModoLote::ejecutar(opcionesLote);
+    }
+    
     std::cout << "=== SIMULADOR MLFQ ===" << std::endl;
     std::cout << "Ingrese la ruta del archivo de entrada: ";
     std::getline(std::cin, archivoEntrada);
@@ -177,28 +828,36 @@ int main() {
         std::cin >> opcion;
         
         switch (opcion) {
-            case 1:
-                ejecutarSimulacion(archivoEntrada, "ConfigA", 1);
+            case 1: {
+                ReferenciaSRPT srpt;
+                ejecutarSimulacion(archivoEntrada, "ConfigA", 1, srpt);
                 break;
+            }
             
-            case 2:
-                ejecutarSimulacion(archivoEntrada, "ConfigB", 2);
+            case 2: {
+                ReferenciaSRPT srpt;
+                ejecutarSimulacion(archivoEntrada, "ConfigB", 2, srpt);
                 break;
+            }
             
-            case 3:
-                ejecutarSimulacion(archivoEntrada, "ConfigC", 3);
+            case 3: {
+                ReferenciaSRPT srpt;
+                ejecutarSimulacion(archivoEntrada, "ConfigC", 3, srpt);
                 break;
+            }
             
-            case 4:
+            case 4: {
                 std::cout << "\n=== EJECUTANDO TODAS LAS CONFIGURACIONES ===" << std::endl;
-                ejecutarSimulacion(archivoEntrada, "ConfigA", 1);
-                ejecutarSimulacion(archivoEntrada, "ConfigB", 2);
-                ejecutarSimulacion(archivoEntrada, "ConfigC", 3);
+                ReferenciaSRPT srpt;        // Misma carga: SRPT se simula una sola vez
+                ejecutarSimulacion(archivoEntrada, "ConfigA", 1, srpt);
+                ejecutarSimulacion(archivoEntrada, "ConfigB", 2, srpt);
+                ejecutarSimulacion(archivoEntrada, "ConfigC", 3, srpt);
                 
                 // Mostrar comparación
                 std::cout << "\n=== COMPARACIÓN DE CONFIGURACIONES ===" << std::endl;
                 std::cout << "Ver archivos de salida generados para comparar métricas." << std::endl;
                 break;
+            }
             
             case 5:
                 configuracionPersonalizada(archivoEntrada);
@@ -209,11 +868,19 @@ int main() {
                 std::cout << "¡Gracias por usar el simulador MLFQ!" << std::endl;
                 break;
             
+            case 7:
+                simulacionMulticore(archivoEntrada);
+                break;
+            
+            case 8:
+                bifurcarDesdeInstantanea(archivoEntrada);
+                break;
+            
             default:
                 std::cout << "Opción no válida. Intente nuevamente." << std::endl;
         }
         
-        if (continuar && opcion >= 1 && opcion <= 5) {
+        if (continuar && opcion >= 1 && opcion <= 8) {
             std::cout << "\nPresione Enter para continuar...";
             std::cin.ignore();
             std::cin.get();
@@ -0,0 +1,142 @@
+#include "mlfq_api.h"
+#include "PlanificadorMLFQ.h"
+#include "MotorFijo.h"
+#include <algorithm>
+#include <new>
+
+/**
+ * Estado interno del motor: el planificador con sus colas ya configuradas y,
+ * para cargas de hasta 256 trabajos en hasta 8 niveles, el motor de capacidad
+ * fija, que da los mismos resultados sin reservar memoria en cada ejecución
+ */
+struct mlfq_motor {
+    PlanificadorMLFQ planificador;
+    MotorFijo<> fijo;
+    bool usaFijo;
+    int numNiveles;
+};
+
+mlfq_motor* mlfq_crear(const mlfq_nivel* niveles, int numNiveles) {
+    if (niveles == nullptr || numNiveles <= 0 || numNiveles > MapaNiveles::MAX_NIVELES) {
+        return nullptr;
+    }
+
+    std::vector<ConfiguracionCola> configuraciones;
+    for (int i = 0; i < numNiveles; i++) {
+        TipoAlgoritmo algoritmo;
+        switch (niveles[i].algoritmo) {
+            case MLFQ_RR:
+                if (niveles[i].quantum <= 0) return nullptr;
+                algoritmo = TipoAlgoritmo::ROUND_ROBIN;
+                break;
+            case MLFQ_SJF:
+                algoritmo = TipoAlgoritmo::SJF;
+                break;
+            case MLFQ_STCF:
+                algoritmo = TipoAlgoritmo::STCF;
+                break;
+            default:
+                return nullptr;
+        }
+        configuraciones.push_back(ConfiguracionCola(i + 1, algoritmo, std::max(1, niveles[i].quantum)));
+    }
+
+    mlfq_motor* motor = new (std::nothrow) mlfq_motor();
+    if (motor == nullptr) {
+        return nullptr;
+    }
+
+    try {
+        motor->planificador.configurarColas(configuraciones);
+    } catch (...) {
+        delete motor;
+        return nullptr;
+    }
+    motor->numNiveles = numNiveles;
+    motor->usaFijo = motor->fijo.configurar(niveles, numNiveles) == MLFQ_OK;
+    return motor;
+}
+
+int mlfq_ejecutar(mlfq_motor* motor, const mlfq_trabajo* trabajos, int numTrabajos,
+                  mlfq_metricas_trabajo* metricas, mlfq_resumen* resumen) {
+    if (motor == nullptr || trabajos == nullptr || numTrabajos <= 0) {
+        return MLFQ_ERROR_ARGUMENTOS;
+    }
+
+    // Validar con las mismas reglas que el lector de archivos
+    for (int i = 0; i < numTrabajos; i++) {
+        const mlfq_trabajo& trabajo = trabajos[i];
+        if (trabajo.burstTime <= 0 || trabajo.arrivalTime < 0 || trabajo.priority <= 0 ||
+            trabajo.queueLevel <= 0 || trabajo.queueLevel > motor->numNiveles) {
+            return MLFQ_ERROR_TRABAJO;
+        }
+    }
+
+    if (motor->usaFijo && numTrabajos <= MotorFijo<>::CAPACIDAD_TRABAJOS) {
+        return motor->fijo.simular(trabajos, numTrabajos, metricas, resumen);
+    }
+
+    // El planificador reordena su vector por llegada; se conserva el orden de entrada aparte
+    std::vector<Proceso*> procesos;
+    try {
+        procesos.reserve(numTrabajos);
+        for (int i = 0; i < numTrabajos; i++) {
+            const mlfq_trabajo& trabajo = trabajos[i];
+            Proceso* proceso = new Proceso(trabajo.etiqueta != nullptr ? trabajo.etiqueta : "",
+                                           trabajo.burstTime, trabajo.arrivalTime,
+                                           trabajo.queueLevel, trabajo.priority);
+            procesos.push_back(proceso);
+            motor->planificador.agregarProceso(proceso);
+        }
+
+        motor->planificador.ejecutarSimulacion();
+    } catch (...) {
+        motor->planificador.limpiarProcesos();
+        return MLFQ_ERROR_INTERNO;
+    }
+
+    int makespan = 0;
+    for (int i = 0; i < numTrabajos; i++) {
+        const Proceso* proceso = procesos[i];
+        makespan = std::max(makespan, proceso->getCompletionTime());
+        if (metricas != nullptr) {
+            metricas[i].waitingTime = proceso->getWaitingTime();
+            metricas[i].completionTime = proceso->getCompletionTime();
+            metricas[i].responseTime = proceso->getResponseTime();
+            metricas[i].turnaroundTime = proceso->getTurnaroundTime();
+        }
+    }
+
+    if (resumen != nullptr) {
+        resumen->promedioWT = motor->planificador.getPromedioWT();
+        resumen->promedioCT = motor->planificador.getPromedioCT();
+        resumen->promedioRT = motor->planificador.getPromedioRT();
+        resumen->promedioTAT = motor->planificador.getPromedioTAT();
+        resumen->makespan = makespan;
+        resumen->numIntervalos = static_cast<int>(motor->planificador.getHistorialEjecucion().size());
+    }
+
+    motor->planificador.limpiarProcesos();
+    return MLFQ_OK;
+}
+
+void mlfq_destruir(mlfq_motor* motor) {
+    delete motor;
+}
+
+int mlfq_simular(const mlfq_trabajo* trabajos, int numTrabajos,
+                 const mlfq_nivel* niveles, int numNiveles,
+                 mlfq_metricas_trabajo* metricas, mlfq_resumen* resumen) {
+    mlfq_motor* motor = mlfq_crear(niveles, numNiveles);
+    if (motor == nullptr) {
+        return niveles == nullptr || numNiveles <= 0 ? MLFQ_ERROR_ARGUMENTOS : MLFQ_ERROR_NIVEL;
+    }
+
+    int resultado = mlfq_ejecutar(motor, trabajos, numTrabajos, metricas, resumen);
+    mlfq_destruir(motor);
+    return resultado;
+}
+
+const char* mlfq_version(void) {
+    return "1.0";
+}
@@ -0,0 +1,110 @@
+#ifndef MLFQ_API_H
+#define MLFQ_API_H
+
+/**
+ * API en memoria del motor MLFQ (compatible con C y C++)
+ *
+ * Permite simular cargas de trabajo sin archivos: el llamador entrega los
+ * trabajos y la configuración de niveles en arreglos y recibe las métricas
+ * en buffers que él mismo reserva.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Códigos de retorno */
+#define MLFQ_OK                  0
+#define MLFQ_ERROR_ARGUMENTOS   -1   /* Punteros nulos o tamaños inválidos */
+#define MLFQ_ERROR_TRABAJO      -2   /* Un trabajo tiene valores inválidos */
+#define MLFQ_ERROR_NIVEL        -3   /* Un nivel tiene algoritmo o quantum inválido */
+#define MLFQ_ERROR_INTERNO      -4   /* Error inesperado del motor (p. ej. memoria) */
+
+/* Algoritmos de un nivel */
+#define MLFQ_RR    0
+#define MLFQ_SJF   1
+#define MLFQ_STCF  2
+
+/**
+ * Trabajo de entrada (equivale a una línea del archivo de procesos)
+ */
+typedef struct {
+    const char* etiqueta;   /* Puede ser NULL */
+    int burstTime;          /* > 0 */
+    int arrivalTime;        /* >= 0 */
+    int queueLevel;         /* 1..numNiveles */
+    int priority;           /* > 0 */
+} mlfq_trabajo;
+
+/**
+ * Nivel de cola, ordenados de mayor a menor prioridad
+ */
+typedef struct {
+    int algoritmo;          /* MLFQ_RR, MLFQ_SJF o MLFQ_STCF */
+    int quantum;            /* Solo usado en MLFQ_RR, > 0 */
+} mlfq_nivel;
+
+/**
+ * Métricas de un trabajo, en el mismo orden del arreglo de entrada
+ */
+typedef struct {
+    int waitingTime;
+    int completionTime;
+    int responseTime;
+    int turnaroundTime;
+} mlfq_metricas_trabajo;
+
+/**
+ * Métricas agregadas de una simulación
+ */
+typedef struct {
+    double promedioWT;
+    double promedioCT;
+    double promedioRT;
+    double promedioTAT;
+    int makespan;           /* Instante de finalización del último trabajo */
+    int numIntervalos;      /* Intervalos registrados en el historial */
+} mlfq_resumen;
+
+/**
+ * Motor reutilizable: conserva la configuración de niveles entre simulaciones
+ */
+typedef struct mlfq_motor mlfq_motor;
+
+/**
+ * Crea un motor con la configuración de niveles indicada
+ * @return NULL si la configuración no es válida
+ */
+mlfq_motor* mlfq_crear(const mlfq_nivel* niveles, int numNiveles);
+
+/**
+ * Simula un arreglo de trabajos con el motor indicado
+ * @param metricas: buffer de numTrabajos elementos (puede ser NULL)
+ * @param resumen: buffer para los agregados (puede ser NULL)
+ * @return MLFQ_OK o un código de error
+ */
+int mlfq_ejecutar(mlfq_motor* motor, const mlfq_trabajo* trabajos, int numTrabajos,
+                  mlfq_metricas_trabajo* metricas, mlfq_resumen* resumen);
+
+/**
+ * Libera un motor creado con mlfq_crear
+ */
+void mlfq_destruir(mlfq_motor* motor);
+
+/**
+ * Atajo para una sola simulación: crea, ejecuta y destruye el motor
+ */
+int mlfq_simular(const mlfq_trabajo* trabajos, int numTrabajos,
+                 const mlfq_nivel* niveles, int numNiveles,
+                 mlfq_metricas_trabajo* metricas, mlfq_resumen* resumen);
+
+/**
+ * Versión del motor
+ */
+const char* mlfq_version(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MLFQ_API_H */